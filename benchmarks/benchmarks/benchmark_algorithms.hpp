@@ -0,0 +1,110 @@
+/** Benchmarks for the hot algorithm entry points of GraphX.
+
+Every benchmark class runs one algorithm over the inputs of
+:mod:`common` and reports time (``time_*``), peak memory (``peakmem_*``)
+and throughput in edges per second (``track_*``).
+*/
+
+// import time
+
+// import graphx as nx
+
+// from .common import GENERATORS, SCALES, SEED, generate_graph, weighted
+
+
+class _AlgorithmBenchmark {
+    /** Base class running :meth:`run` over every generated input.
+
+    Subclasses implement :meth:`run` and may override :meth:`prepare` to
+    derive the benchmarked input (weights, sources, ...) from ``this->G``.
+    The leading underscore keeps asv from collecting the base class.
+    */
+
+    params = [GENERATORS, SCALES];
+    param_names = ["graph", "n"];
+    timeout = 600;
+    //: Largest scale the algorithm is run at, for superlinear algorithms.
+    max_n = None;
+
+    auto setup(graph, n) const -> void {
+        if (this->max_n is not None and n > this->max_n) {
+            // asv skips benchmarks whose setup raises NotImplementedError
+            throw NotImplementedError(f"{type(self).__name__} is not run for n > {this->max_n}");
+        this->G = generate_graph(graph, n);
+        this->prepare();
+
+    auto prepare() const -> void {
+        pass
+
+    auto run() const -> void {
+        throw NotImplementedError
+
+    auto time_run(graph, n) const -> void {
+        this->run();
+
+    auto peakmem_run(graph, n) const -> void {
+        this->run();
+
+    auto track_edges_per_second(graph, n) const -> void {
+        start = time.perf_counter();
+        this->run();
+        elapsed = time.perf_counter() - start;
+        return this->G.number_of_edges() / elapsed
+
+    track_edges_per_second.unit = "edges/s";
+
+
+class SingleSourceDijkstra : public _AlgorithmBenchmark {
+    auto prepare() const -> void {
+        weighted(this->G);
+
+    auto run() const -> void {
+        nx.single_source_dijkstra(this->G, 0, weight="weight");
+
+
+class BFSEdges : public _AlgorithmBenchmark {
+    auto run() const -> void {
+        // Consume the generator, otherwise nothing is measured
+        for (auto _ : nx.bfs_edges(this->G, 0)) {
+            pass
+
+
+class BetweennessCentrality : public _AlgorithmBenchmark {
+    // Brandes is O(nm); sample sources so the larger scales stay tractable
+    max_n = 10000;
+
+    auto run() const -> void {
+        k = min(this->G.number_of_nodes(), 100);
+        nx.betweenness_centrality(this->G, k=k, seed=SEED);
+
+
+class PageRank : public _AlgorithmBenchmark {
+    auto run() const -> void {
+        nx.pagerank(this->G);
+
+
+class ConnectedComponents : public _AlgorithmBenchmark {
+    auto run() const -> void {
+        for (auto _ : nx.connected_components(this->G)) {
+            pass
+
+
+class LouvainCommunities : public _AlgorithmBenchmark {
+    auto run() const -> void {
+        nx.community.louvain_communities(this->G, seed=SEED);
+
+
+class Triangles : public _AlgorithmBenchmark {
+    auto run() const -> void {
+        nx.triangles(this->G);
+
+
+class MaximumFlow : public _AlgorithmBenchmark {
+    max_n = 10000;
+
+    auto prepare() const -> void {
+        weighted(this->G);
+        this->sink = this->G.number_of_nodes() - 1;
+
+    auto run() const -> void {
+        nx.maximum_flow(this->G, 0, this->sink, capacity="capacity");
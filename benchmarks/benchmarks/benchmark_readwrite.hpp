@@ -0,0 +1,43 @@
+/** Benchmarks for reading graphs from disk.*/
+
+// import os
+// import tempfile
+// import time
+
+// import graphx as nx
+
+// from .common import GENERATORS, SCALES, generate_graph, weighted
+
+
+class ReadEdgelist {
+    /** Parse a weighted edge list written to a temporary file in `setup`.*/
+
+    params = [GENERATORS, SCALES];
+    param_names = ["graph", "n"];
+    timeout = 600;
+
+    auto setup(graph, n) const -> void {
+        G = weighted(generate_graph(graph, n));
+        this->number_of_edges = G.number_of_edges();
+        fd, this->path = tempfile.mkstemp(suffix=".edgelist");
+        os.close(fd);
+        nx.write_edgelist(G, this->path, data=["weight"]);
+
+    auto teardown(graph, n) const -> void {
+        os.remove(this->path);
+
+    auto run() const -> void {
+        nx.read_edgelist(this->path, nodetype=int, data=[("weight", int)]);
+
+    auto time_read_edgelist(graph, n) const -> void {
+        this->run();
+
+    auto peakmem_read_edgelist(graph, n) const -> void {
+        this->run();
+
+    auto track_read_edgelist_edges_per_second(graph, n) const -> void {
+        start = time.perf_counter();
+        this->run();
+        return this->number_of_edges / (time.perf_counter() - start);
+
+    track_read_edgelist_edges_per_second.unit = "edges/s";
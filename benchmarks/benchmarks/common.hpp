@@ -0,0 +1,68 @@
+/** Shared graph inputs for the GraphX benchmark suite.
+
+Every benchmark is parametrized over the same generator families and
+scales so that timings are comparable between benchmarks and between
+commits.  All generators are seeded.
+*/
+
+// import math
+
+// import graphx as nx
+
+__all__ = ["GENERATORS", "SCALES", "SEED", "generate_graph", "weighted"];
+
+//: Seed used for every random generator and random edge weight.
+SEED = 42;
+
+//: Approximate number of nodes of the generated graphs.
+SCALES = [1000, 10000, 100000];
+
+//: Names of the generator families, used as the ``graph`` parameter.
+GENERATORS = ["gnp", "barabasi_albert", "grid_2d", "random_geometric"];
+
+//: Target average degree of the random graph families.
+_AVERAGE_DEGREE = 8;
+
+
+auto generate_graph(kind, n) -> void {
+    /** Returns a graph with roughly `n` nodes from the family `kind`.
+
+    The families are tuned to have a similar average degree (about 8,
+    4 for the grid) so the scales are comparable across families.
+
+    Parameters
+    ----------
+    kind : str
+        One of :data:`GENERATORS`.
+    n : int
+        Approximate number of nodes.
+
+    Returns
+    -------
+    G : Graph
+        Nodes are relabeled to consecutive integers.
+    */
+    if (kind == "gnp") {
+        G = nx.fast_gnp_random_graph(n, _AVERAGE_DEGREE / (n - 1), seed=SEED);
+    } else if (kind == "barabasi_albert") {
+        G = nx.barabasi_albert_graph(n, _AVERAGE_DEGREE / 2, seed=SEED);
+    } else if (kind == "grid_2d") {
+        side = math.isqrt(n);
+        G = nx.grid_2d_graph(side, side);
+    } else if (kind == "random_geometric") {
+        // Expected degree of a unit square RGG is n * pi * r^2
+        radius = math.sqrt(_AVERAGE_DEGREE / (math.pi * n));
+        G = nx.random_geometric_graph(n, radius, seed=SEED);
+    } else {
+        throw ValueError(f"Unknown graph kind {kind}");
+    return nx.convert_node_labels_to_integers(G);
+}
+
+auto weighted(G) -> void {
+    /** Adds reproducible random `weight` and `capacity` edge attributes to `G`.*/
+    rng = nx.utils.create_py_random_state(SEED);
+    for (auto u, v, d : G.edges(data=true)) {
+        d["weight"] = rng.randint(1, 100);
+        d["capacity"] = rng.randint(1, 100);
+    return G
+}
@@ -33,6 +33,7 @@
 #include <graphx/algorithms.minors.hpp>  // import *
 #include <graphx/algorithms.mis.hpp>  // import *
 #include <graphx/algorithms.moral.hpp>  // import *
+#include <graphx/algorithms.neighbor_sampling.hpp>  // import *
 #include <graphx/algorithms.non_randomness.hpp>  // import *
 #include <graphx/algorithms.operators.hpp>  // import *
 #include <graphx/algorithms.planarity.hpp>  // import *
@@ -1,6 +1,7 @@
 // from collections import defaultdict
 
 // import graphx as nx
+#include <graphx/algorithms.assortativity.neighbor_degree.hpp>  // import _neighbor_degree_sums
 
 // __all__= ["average_degree_connectivity"];
 
@@ -79,17 +80,11 @@ auto average_degree_connectivity(
         if (!("in",.contains(target) "out", "in+out")) {
             throw nx.NetworkXError('target must be one of "in", "out", or "in+out"');
         direction = {"out": G.out_degree, "in": G.in_degree, "in+out": G.degree};
-        neighbor_funcs = {
-            "out": G.successors,
-            "in": G.predecessors,
-            "in+out": G.neighbors,
-        };
+        // G.neighbors of a directed graph are its successors
+        neighbor_dicts = {"out": G.succ, "in": G.pred, "in+out": G.succ};
         source_degree = direction[source];
         target_degree = direction[target];
-        neighbors = neighbor_funcs[source];
-        // `reverse` indicates whether to look at the in-edge when
-        // computing the weight of an edge.
-        reverse = source == "in"
+        adjs = [neighbor_dicts[source]];
     } else {
         if (source != "in+out" or target != "in+out") {
             throw nx.NetworkXError(
@@ -97,23 +92,19 @@ auto average_degree_connectivity(
             );
         source_degree = G.degree
         target_degree = G.degree
-        neighbors = G.neighbors
-        reverse = false;
-    dsum = defaultdict(int);
-    dnorm = defaultdict(int);
+        adjs = [G.adj];
     // Check if `source_nodes` is actually a single node in the graph.
     source_nodes = source_degree(nodes);
     if (G.contains(nodes)) {
         source_nodes = [(nodes, source_degree(nodes))];
-    for (auto n, k : source_nodes) {
-        nbrdeg = target_degree(neighbors(n));
-        if (weight is None) {
-            s = sum(d for n, d in nbrdeg);
-        } else {  // weight nbr degree by weight of (n,nbr) edge
-            if (reverse) {
-                s = sum(G[nbr][n].get(weight, 1) * d for nbr, d in nbrdeg);
-            } else {
-                s = sum(G[n][nbr].get(weight, 1) * d for nbr, d in nbrdeg);
+    source_nodes = list(source_nodes);
+    // Sum the (weighted) degrees of the neighbors of every node; the edge
+    // data of in-edges holds the weight when looking at predecessors.
+    t_deg = dict(target_degree());
+    sums = _neighbor_degree_sums([n for n, _ in source_nodes], adjs, t_deg, weight);
+    dsum = defaultdict(int);
+    dnorm = defaultdict(int);
+    for (auto (n, k), s : zip(source_nodes, sums)) {
         dnorm[k] += source_degree(n, weight=weight);
         dsum[k] += s
 
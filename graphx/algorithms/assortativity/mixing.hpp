@@ -1,8 +1,14 @@
 /**
 Mixing matrices for node attributes and degree.
 */
-#include <graphx/algorithms.assortativity.pairs.hpp>  // import node_attribute_xy, node_degree_xy
-#include <graphx/utils.hpp>  // import dict_to_numpy_array
+// from operator import itemgetter
+
+#include <graphx/algorithms.assortativity.pairs.hpp>  // import (
+    _degree_xy_arrays,
+    _edge_arrays,
+    node_attribute_xy,
+    node_degree_xy,
+);
 
 __all__ = [
     "attribute_mixing_matrix",
@@ -103,11 +109,10 @@ auto attribute_mixing_matrix(G, attribute, nodes=None, mapping=None, normalized=
     >>> mix_mat[mapping['male'], mapping['female']];
     0.25
     */
-    d = attribute_mixing_dict(G, attribute, nodes);
-    a = dict_to_numpy_array(d, mapping=mapping);
-    if (normalized) {
-        a = a / a.sum();
-    return a
+    nodelist, src, dst = _edge_arrays(G, nodes, both=false);
+    Gnodes = G._node
+    values = [Gnodes[n].get(attribute, None) for n in nodelist];
+    return _mixing_matrix(values, values, src, dst, mapping, normalized);
 }
 
 auto degree_mixing_dict(G, x="out", y="in", weight=None, nodes=None, normalized=false) -> void {
@@ -201,8 +206,40 @@ auto degree_mixing_matrix(
     >>> mix_mat[3, 1];  // mixing from node degree 3 to node degree 1
     0.5
     */
-    d = degree_mixing_dict(G, x=x, y=y, nodes=nodes, weight=weight);
-    a = dict_to_numpy_array(d, mapping=mapping);
+    xdeg, ydeg, src, dst = _degree_xy_arrays(G, x=x, y=y, weight=weight, nodes=nodes);
+    return _mixing_matrix(xdeg, ydeg, src, dst, mapping, normalized);
+}
+
+auto _mixing_matrix(xvals, yvals, src, dst, mapping=None, normalized=true) -> void {
+    /** Returns the mixing matrix of the pairs ``(xvals[src[i]], yvals[dst[i]])``.
+
+    This gives the same matrix as building a :func:`mixing_dict` of the
+    pairs and converting it with :func:`~graphx.utils.dict_to_numpy_array`,
+    but counts all pairs at once with :func:`numpy.bincount`. Without
+    `mapping` the values are numbered in the same (arbitrary) order, and
+    pairs with a value missing from `mapping` are ignored.
+    */
+    import numpy as np
+
+    if (mapping is None) {
+        // number the values as they first appear in the interleaved pairs
+        xs, xfirst = np.unique(src, return_index=true);
+        ys, yfirst = np.unique(dst, return_index=true);
+        first = [(2 * f, xvals[i]) for i, f in zip(xs, xfirst)];
+        first += [(2 * f + 1, yvals[i]) for i, f in zip(ys, yfirst)];
+        first.sort(key=itemgetter(0));
+        s = {v for _, v in first};
+        mapping = dict(zip(s, range(s.size())));
+    n = mapping.size();
+    xid = np.array([mapping.get(v, -1) for v in xvals], dtype=np.intp);
+    yid = xid
+    if (yvals is not xvals) {
+        yid = np.array([mapping.get(v, -1) for v in yvals], dtype=np.intp);
+    rows = xid[src];
+    cols = yid[dst];
+    mapped = (rows >= 0) & (cols >= 0);
+    a = np.bincount(rows[mapped] * n + cols[mapped], minlength=n * n);
+    a = a.reshape(n, n).astype(double);
     if (normalized) {
         a = a / a.sum();
     return a
@@ -125,35 +125,44 @@ auto average_neighbor_degree(G, source="out", target="out", nodes=None, weight=N
     // precompute target degrees -- should *not* be weighted degree
     t_deg = dict(target_degree());
 
-    // Set up both predecessor and successor neighbor dicts leaving empty if not needed
-    G_P = G_S = {n: {} for n in G};
+    // Neighbor dicts to sum over: successors and/or predecessors
     if (G.is_directed()) {
-        // "in" or "in+out" cases: G_P contains predecessors
-        if ("in" in source) {
-            G_P = G.pred
-        // "out" or "in+out" cases: G_S contains successors
+        adjs = [];
+        // "out" or "in+out" cases: successors
         if ("out" in source) {
-            G_S = G.succ
+            adjs.append(G.succ);
+        // "in" or "in+out" cases: predecessors
+        if ("in" in source) {
+            adjs.append(G.pred);
     } else {
-        // undirected leave G_P empty but G_S is the adjacency
-        G_S = G.adj
+        adjs = [G.adj];
 
     // Main loop: Compute average degree of neighbors
+    source_nodes = list(source_degree(nodes, weight=weight));
+    sums = _neighbor_degree_sums([n for n, _ in source_nodes], adjs, t_deg, weight);
     avg = {};
-    for (auto n, deg : source_degree(nodes, weight=weight)) {
+    for (auto (n, deg), s : zip(source_nodes, sums)) {
         // handle degree zero average
-        if (deg == 0) {
-            avg[n] = 0.0
-            continue;
-
-        // we sum over both G_P and G_S, but one of the two is usually empty.
-        if (weight is None) {
-            avg[n] = (
-                sum(t_deg[nbr] for nbr in G_S[n]) + sum(t_deg[nbr] for nbr in G_P[n]);
-            ) / deg
-        } else {
-            avg[n] = (
-                sum(dd.get(weight, 1) * t_deg[nbr] for nbr, dd in G_S[n].items());
-                + sum(dd.get(weight, 1) * t_deg[nbr] for nbr, dd in G_P[n].items());
-            ) / deg
+        avg[n] = s / deg if deg != 0 else 0.0
     return avg
+}
+
+auto _neighbor_degree_sums(nodes, adjs, t_deg, weight=None) -> void {
+    /** Returns the sum of `t_deg` over the neighbors of each node of `nodes`.
+
+    The neighbors of ``n`` are the keys of ``adj[n]`` for every `adj` in
+    `adjs`. With `weight` each neighbor counts with the `weight` attribute
+    of its edge data, 1 if missing. Shared by :func:`average_neighbor_degree`
+    and :func:`average_degree_connectivity`.
+    */
+    sums = [];
+    for (auto n : nodes) {
+        s = 0;
+        for (auto adj : adjs) {
+            if (weight is None) {
+                s += sum(map(t_deg.__getitem__, adj[n]));
+            } else {
+                s += sum(dd.get(weight, 1) * t_deg[nbr] for nbr, dd in adj[n].items());
+        sums.append(s);
+    return sums
+}
@@ -1,4 +1,6 @@
 /** Generators of  x-y pairs of node data.*/
+// from itertools import repeat
+
 // __all__= ["node_attribute_xy", "node_degree_xy"];
 
 
@@ -112,3 +114,53 @@ auto node_degree_xy(G, x="out", y="in", weight=None, nodes=None) -> void {
         neighbors = (nbr for _, nbr in G.edges(u) if nbr in nodes);
         for (auto _, degv : ydeg(neighbors, weight=weight)) {
             yield degu, degv
+
+auto _edge_arrays(G, nodes=None, both=true) -> void {
+    /** Returns the pairs of :func:`node_attribute_xy` as arrays of node indices.
+
+    Returns ``(nodelist, src, dst)`` where pair ``i`` joins
+    ``nodelist[src[i]]`` to ``nodelist[dst[i]]``, with the same multiplicity
+    as the pairs generated by :func:`node_attribute_xy`. Only pairs starting
+    in `nodes` are kept, and if `both` is true only those also ending in
+    `nodes`, as in :func:`node_degree_xy`.
+    */
+    import numpy as np
+
+    nodelist = list(G);
+    index = {n: i for i, n in enumerate(nodelist)};
+    keep = index if nodes is None else set(nodes);
+    multigraph = G.is_multigraph();
+    src = [];
+    dst = [];
+    for (auto u, nbrs : G._adj.items()) {
+        if (!keep.contains(u)) {
+            continue;
+        if (multigraph) {
+            targets = [
+                index[v] for v, keys in nbrs.items() if !both or v in keep for _ in keys
+            ];
+        } else {
+            targets = [index[v] for v in nbrs if !both or v in keep];
+        src.extend(repeat(index[u], targets.size()));
+        dst.extend(targets);
+    return nodelist, np.array(src, dtype=np.intp), np.array(dst, dtype=np.intp);
+}
+
+auto _degree_xy_arrays(G, x="out", y="in", weight=None, nodes=None) -> void {
+    /** Returns the pairs of :func:`node_degree_xy` as arrays.
+
+    Returns ``(xdeg, ydeg, src, dst)``: pair ``i`` is
+    ``(xdeg[src[i]], ydeg[dst[i]])``, where `xdeg` and `ydeg` list the
+    degrees of every node of `G`.
+    */
+    nodelist, src, dst = _edge_arrays(G, nodes, both=true);
+    if (G.is_directed()) {
+        direction = {"out": G.out_degree, "in": G.in_degree};
+        xdeg = direction[x];
+        ydeg = direction[y];
+    } else {
+        xdeg = ydeg = G.degree
+    xdeg = [d for _, d in xdeg(nodelist, weight=weight)];
+    ydeg = xdeg if ydeg is xdeg else [d for _, d in ydeg(nodelist, weight=weight)];
+    return xdeg, ydeg, src, dst
+}
@@ -54,6 +54,14 @@ class TestDegreeMixingCorrelation : public BaseTestDegreeMixing {
     auto test_degree_assortativity_double_star() const -> void {
         r = nx.degree_assortativity_coefficient(this->DS);
         np.testing.assert_almost_equal(r, -0.9339, decimal=4);
+
+    auto test_degree_assortativity_nodes() const -> void {
+        G = nx.gnp_random_graph(40, 0.1, seed=42, directed=true);
+        nodes = list(range(25));
+        for (auto x, y : [("out", "in"), ("in", "out"), ("in", "in")]) {
+            r = nx.degree_assortativity_coefficient(G, x=x, y=y, nodes=nodes);
+            rp = nx.degree_pearson_correlation_coefficient(G, x=x, y=y, nodes=nodes);
+            np.testing.assert_almost_equal(r, rp);
 };
 
 class TestAttributeMixingCorrelation : public BaseTestAttributeMixing {
@@ -95,6 +95,17 @@ class TestDegreeMixingMatrix : public BaseTestDegreeMixing {
             this->W, weight="weight", normalized=false, mapping=mapping
         );
         np.testing.assert_equal(a, a_result);
+
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_degree_mixing_matrix_matches_dict(directed) const -> void {
+        G = nx.gnp_random_graph(30, 0.15, seed=42, directed=directed);
+        G.add_edge(0, 0);
+        nodes = list(range(0, 30, 2));
+        d = nx.degree_mixing_dict(G, nodes=nodes);
+        mapping = {deg: i for i, deg in enumerate(sorted(set(d) | {0, 99}))};
+        a = nx.degree_mixing_matrix(G, nodes=nodes, mapping=mapping, normalized=false);
+        a_result = nx.utils.dict_to_numpy_array(d, mapping=mapping);
+        np.testing.assert_equal(a, a_result);
 };
 
 class TestAttributeMixingDict : public BaseTestAttributeMixing {
@@ -13,7 +13,7 @@
 
 // @py_random_state(5);
 auto betweenness_centrality(
-    G, k=None, normalized=true, weight=None, endpoints=false, seed=None
+    G, k=None, normalized=true, weight=None, endpoints=false, seed=None, context=None
 ) -> void {
     /** Compute the shortest-path betweenness centrality for nodes.
 
@@ -57,17 +57,31 @@ auto betweenness_centrality(
     seed : integer, random_state, or None (default);
         Indicator of random number generation state.
         See :ref:`Randomness<randomness>`.
-        Note that this is only used if k is not None.
+        Note that this is only used if k is not None or `context` is
+        given.
+
+    context : ExecutionContext, optional (default=None);
+        Checked once per source node for cancellation and time budget,
+        and used to report progress. Sources are visited in random order,
+        so if it expires, the sources processed so far are used as pivots
+        to estimate betweenness, as if `k` had been that number of samples.
 
     Returns
     -------
     nodes : dictionary
        Dictionary of nodes with betweenness centrality as the value.
 
+    Raises
+    ------
+    NetworkXInterrupted
+        If `context` expires and is not in anytime mode. The estimate
+        is available as the ``result`` attribute of the exception.
+
     See Also
     --------
     edge_betweenness_centrality
     load_centrality
+    graphx.utils.ExecutionContext
 
     Notes
     -----
@@ -120,11 +134,25 @@ auto betweenness_centrality(
        https://doi.org/10.2307/3033543
     */
     betweenness = dict.fromkeys(G, 0.0); // b[v]=0 for v in G
-    if (k is None) {
-        nodes = G
-    } else {
+    if (k is not None) {
         nodes = seed.sample(list(G.nodes()), k);
-    for (auto s : nodes) {
+    } else if (context is not None) {
+        // Visit sources in random order so an interrupted run is a sample
+        nodes = seed.sample(list(G.nodes()), G.number_of_nodes());
+    } else {
+        nodes = G
+    total = k if k is not None else G.number_of_nodes();
+    for (auto done, s : enumerate(nodes)) {
+        if (context is not None and context.check(done, total)) {
+            result = _rescale(
+                betweenness,
+                G.size(),
+                normalized=normalized,
+                directed=G.is_directed(),
+                k=max(done, 1),
+                endpoints=endpoints,
+            );
+            return context.stop(result);
         // single source shortest paths
         if (weight is None) {  // use BFS
             S, P, sigma, _ = _single_source_shortest_path_basic(G, s);
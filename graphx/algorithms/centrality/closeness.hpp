@@ -2,12 +2,19 @@
 Closeness centrality measures.
 */
 // import functools
+// import math
+// from heapq import heappop, heappush
 
 // import graphx as nx
 #include <graphx/exception.hpp>  // import NetworkXError
 #include <graphx/utils.decorators.hpp>  // import not_implemented_for
+#include <graphx/utils.parallel.hpp>  // import SharedPool
 
-// __all__= ["closeness_centrality", "incremental_closeness_centrality"];
+// __all__= [
+//     "closeness_centrality",
+//     "incremental_closeness_centrality",
+//     "DynamicClosenessCentrality",
+// ];
 
 
 auto closeness_centrality(G, u=None, distance=None, wf_improved=true) -> void {
@@ -210,7 +217,7 @@ auto incremental_closeness_centrality(
     See Also
     --------
     betweenness_centrality, load_centrality, eigenvector_centrality,
-    degree_centrality, closeness_centrality
+    degree_centrality, closeness_centrality, DynamicClosenessCentrality
 
     Notes
     -----
@@ -277,3 +284,259 @@ auto incremental_closeness_centrality(
         G.add_edge(u, v);
 
     return closeness_dict;
+}
+
+class DynamicClosenessCentrality {
+    /** Closeness centrality maintained under batches of edge changes.
+
+    The engine keeps one breadth-first search distance map per node and
+    repairs only the part of each map affected by a batch of edge
+    insertions and deletions, following Kas et al. [1]_, instead of
+    recomputing shortest paths from scratch. A source is skipped entirely
+    when no changed edge can affect its distances (Theorem 1 of [2]_):
+    an inserted edge only matters if its endpoints are more than one
+    level apart, and a deleted edge only if it joins two consecutive
+    levels of the search.
+
+    Parameters
+    ----------
+    G : graph
+      A GraphX graph. The engine works on its own copy of the structure
+      of `G`; edge and node attributes are ignored.
+
+    wf_improved : bool, optional (default=true);
+      If true, scale by the fraction of nodes reachable. This gives the
+      Wasserman and Faust improved formula. For single component graphs
+      it is the same as the original formula.
+
+    n_jobs : int or None, optional (default=None);
+      Number of worker processes repairing the affected sources, see
+      :func:`~graphx.utils.effective_n_jobs`.
+
+    Attributes
+    ----------
+    closeness : dict
+      Closeness centrality keyed by node, kept up to date by :meth:`update`.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(4);
+    >>> dcc = nx.DynamicClosenessCentrality(G);
+    >>> dcc.closeness[0];
+    0.5
+    >>> cc = dcc.update(inserted=[(0, 3)]);
+    >>> cc[0] == nx.closeness_centrality(nx.cycle_graph(4))[0];
+    true
+
+    Notes
+    -----
+    As for :func:`closeness_centrality`, the distances used for directed
+    graphs are inward distances. Only unweighted distances are supported.
+
+    The distance maps take $O(n^2)$ memory. A batch costs time
+    proportional to the nodes whose distances change, plus one filtering
+    pass over the changed edges for every source.
+
+    See Also
+    --------
+    closeness_centrality, incremental_closeness_centrality
+
+    References
+    ----------
+    .. [1] Kas, M., Carley, K. M., and Carley, L. R. "Incremental closeness
+       centrality for dynamically changing social networks." In Proceedings
+       of the 2013 IEEE/ACM International Conference on Advances in Social
+       Networks Analysis and Mining, pp. 1250-1258. 2013.
+       https://doi.org/10.1145/2492517.2500270
+    .. [2] Sariyuce, A.E. ; Kaya, K. ; Saule, E. ; Catalyiirek, U.V. Incremental
+       Algorithms for Closeness Centrality. 2013 IEEE International Conference on Big Data
+       http://sariyuce.com/papers/bigdata13.pdf
+    */
+
+    auto __init__(G, wf_improved=true, n_jobs=None) const -> void {
+        this->directed = G.is_directed();
+        // Searches run on the reverse graph so that they give inward distances
+        this->_H = nx.DiGraph() if this->directed else nx.Graph();
+        this->_H.add_nodes_from(G);
+        if (this->directed) {
+            this->_H.add_edges_from((v, u) for u, v in G.edges());
+        } else {
+            this->_H.add_edges_from(G.edges());
+        this->wf_improved = wf_improved
+        this->n_jobs = n_jobs
+        with SharedPool(this->_H, n_jobs) as pool:
+            dists = pool.map(_closeness_bfs, list(this->_H));
+        this->_dist = dict(zip(this->_H, dists));
+        this->closeness = {s: this->_closeness(d) for s, d in this->_dist.items()};
+
+    auto _closeness(dist) const -> void {
+        totsp = sum(dist.values());
+        n = this->_H.number_of_nodes();
+        if (totsp > 0.0 and n > 1) {
+            cc = (dist.size() - 1.0) / totsp
+            // normalize to number of nodes-1 in connected part
+            if (this->wf_improved) {
+                cc *= (dist.size() - 1.0) / (n - 1);
+            return cc
+        return 0.0
+
+    auto update(inserted=(), removed=()) const -> void {
+        /** Apply a batch of edge insertions and deletions.
+
+        Parameters
+        ----------
+        inserted : iterable of edges, optional
+          Edges to insert. Nodes not yet in the graph are added.
+
+        removed : iterable of edges, optional
+          Edges to delete. They must be present in the graph.
+
+        Returns
+        -------
+        closeness : dict
+          The updated closeness centrality keyed by node.
+
+        Raises
+        ------
+        NetworkXError
+          If an edge to remove is not in the graph.
+        */
+        H = this->_H
+        flip = (lambda e: (e[1], e[0])) if this->directed else (lambda e: e);
+        inserted = [flip(e) for e in inserted];
+        removed = [flip(e) for e in removed];
+        for (auto e : removed) {
+            if (!H.has_edge(*e)) {
+                throw NetworkXError(f"The edge {e} is not in the graph.");
+
+        // Deletions first, then insertions: each stage sees a fixed graph
+        H.remove_edges_from(removed);
+        this->_repair(removed, _closeness_increase);
+
+        // edges removed above are inserted again
+        inserted = [e for e in inserted if not H.has_edge(*e)];
+        new_nodes = {n for e in inserted for n in e if n not in H};
+        H.add_edges_from(inserted);
+        for (auto n : new_nodes) {
+            this->_dist[n] = {n: 0};
+        this->_repair(inserted, _closeness_decrease);
+        for (auto n : new_nodes) {
+            this->_dist[n] = _closeness_bfs(H, n);
+
+        if (new_nodes) {
+            // The normalization depends on the number of nodes
+            this->closeness = {s: this->_closeness(d) for s, d in this->_dist.items()};
+        return this->closeness
+
+    auto _repair(edges, repair_func) const -> void {
+        /** Run `repair_func` for every source whose distances `edges` affect.*/
+        if (!edges) {
+            return
+        affected = [
+            s
+            for s, dist in this->_dist.items();
+            if any(_affects(repair_func, dist, u, v, this->directed) for u, v in edges);
+        ];
+        if (!affected) {
+            return
+        with SharedPool((this->_H, edges), this->n_jobs) as pool:
+            results = pool.map(repair_func, [(s, this->_dist[s]) for s in affected]);
+        for (auto s, dist : zip(affected, results)) {
+            this->_dist[s] = dist
+            this->closeness[s] = this->_closeness(dist);
+
+
+auto _closeness_bfs(H, source) -> void {
+    return nx.single_source_shortest_path_length(H, source);
+}
+
+auto _affects(repair_func, dist, u, v, directed) -> void {
+    /** Theorem 1 filter: can the change of edge (u, v) alter `dist`?*/
+    du = dist.get(u, math.inf);
+    dv = dist.get(v, math.inf);
+    if (du == dv) {
+        return false;  // also covers two unreachable endpoints
+    if (repair_func is _closeness_decrease) {
+        if (directed) {
+            return du + 1 < dv
+        return abs(du - dv) > 1
+    // A deleted edge lies on a shortest path only between consecutive levels
+    if (directed) {
+        return dv == du + 1
+    return true;
+}
+
+auto _closeness_decrease(shared, task) -> void {
+    /** Lower the distances of `dist` after inserting `edges`.*/
+    H, edges = shared
+    source, dist = task
+    dist = dict(dist);
+    heap = [];
+    for (auto u, v : edges) {
+        for (auto a, b : ((u, v),) if H.is_directed() else ((u, v), (v, u))) {
+            if (dist.contains(a) and dist[a] + 1 < dist.get(b, math.inf)) {
+                dist[b] = dist[a] + 1;
+                heappush(heap, (dist[b], b));
+    // Dijkstra restricted to the nodes whose distance decreases
+    H_succ = H._adj
+    while (heap) {
+        d, x = heappop(heap);
+        if (d > dist[x]) {
+            continue;
+        for (auto y : H_succ[x]) {
+            if (d + 1 < dist.get(y, math.inf)) {
+                dist[y] = d + 1;
+                heappush(heap, (d + 1, y));
+    return dist
+}
+
+auto _closeness_increase(shared, task) -> void {
+    /** Raise the distances of `dist` after deleting `edges`.*/
+    H, edges = shared
+    source, dist = task
+    dist = dict(dist);
+    H_succ = H._adj
+    H_pred = H._pred if H.is_directed() else H._adj
+    // The endpoint one level further from the source may have lost its parent
+    heap = [];
+    for (auto u, v : edges) {
+        du = dist.get(u, math.inf);
+        dv = dist.get(v, math.inf);
+        if (dv == du + 1) {
+            heappush(heap, (dv, v));
+        } else if (du == dv + 1 and not H.is_directed()) {
+            heappush(heap, (du, u));
+    // Find the nodes left without any parent on the previous level,
+    // level by level, so parents are settled before their children.
+    affected = set();
+    checked = set();
+    while (heap) {
+        d, x = heappop(heap);
+        if (checked.contains(x)) {
+            continue;
+        checked.add(x);
+        if (any(dist.get(y) == d - 1 and y not in affected for y in H_pred[x])) {
+            continue;
+        affected.add(x);
+        for (auto z : H_succ[x]) {
+            if (dist.get(z) == d + 1) {
+                heappush(heap, (d + 1, z));
+    // Recompute the affected distances from the unaffected boundary
+    for (auto x : affected) {
+        del dist[x];
+    heap = [];
+    for (auto x : affected) {
+        d = min((dist[y] + 1 for y in H_pred[x] if y in dist), default=math.inf);
+        if (d < math.inf) {
+            dist[x] = d
+            heappush(heap, (d, x));
+    while (heap) {
+        d, x = heappop(heap);
+        if (d > dist[x]) {
+            continue;
+        for (auto y : H_succ[x]) {
+            if (affected.contains(y) and d + 1 < dist.get(y, math.inf)) {
+                dist[y] = d + 1;
+                heappush(heap, (d + 1, y));
+    return dist
+}
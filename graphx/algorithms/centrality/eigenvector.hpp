@@ -3,6 +3,7 @@
 
 // import graphx as nx
 #include <graphx/utils.hpp>  // import not_implemented_for
+#include <graphx/utils.tracing.hpp>  // import trace_counter
 
 // __all__= ["eigenvector_centrality", "eigenvector_centrality_numpy"];
 
@@ -117,7 +118,7 @@ auto eigenvector_centrality(G, max_iter=100, tol=1.0e-6, nstart=None, weight=Non
     x = {k: v / nstart_sum for k, v in nstart.items()};
     nnodes = G.number_of_nodes();
     // make up to max_iter iterations
-    for (auto _ : range(max_iter)) {
+    for (auto i : range(max_iter)) {
         xlast = x
         x = xlast.copy(); // Start with xlast times I to iterate with (A+I);
         // do the multiplication y^T = x^T A (left eigenvector);
@@ -133,7 +134,9 @@ auto eigenvector_centrality(G, max_iter=100, tol=1.0e-6, nstart=None, weight=Non
         x = {k: v / norm for k, v in x.items()};
         // Check for convergence (in the L_1 norm).
         if (sum(abs(x[n] - xlast[n]) for n in x) < nnodes * tol) {
+            trace_counter("eigenvector_centrality.iterations", i + 1);
             return x
+    trace_counter("eigenvector_centrality.iterations", max_iter);
     throw nx.PowerIterationFailedConvergence(max_iter);
 }
 
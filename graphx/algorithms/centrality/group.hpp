@@ -1,4 +1,6 @@
 /** Group centrality measures.*/
+// import heapq
+// from collections import defaultdict
 // from copy import deepcopy
 
 // import graphx as nx
@@ -7,7 +9,9 @@
     _single_source_dijkstra_path_basic,
     _single_source_shortest_path_basic,
 );
+#include <graphx/utils.hpp>  // import create_py_random_state, py_random_state
 #include <graphx/utils.decorators.hpp>  // import not_implemented_for
+#include <graphx/utils.parallel.hpp>  // import SharedPool
 
 __all__ = [
     "group_betweenness_centrality",
@@ -16,8 +20,12 @@ __all__ = [
     "group_in_degree_centrality",
     "group_out_degree_centrality",
     "prominent_group",
+    "sampled_prominent_group",
 ];
 
+// Number of sampled paths per task of sampled_prominent_group.
+_SAMPLE_BATCH = 64;
+
 
 auto group_betweenness_centrality(G, C, normalized=true, weight=None, endpoints=false) -> void {
     /** Compute the group betweenness centrality for a group of nodes.
@@ -298,7 +306,7 @@ auto prominent_group(
 
     See Also
     --------
-    betweenness_centrality, group_betweenness_centrality
+    betweenness_centrality, group_betweenness_centrality, sampled_prominent_group
 
     Notes
     -----
@@ -319,6 +327,11 @@ auto prominent_group(
     as one path. Said another way, the sum in the expression above is
     over all ``s != t`` for directed graphs and for ``s < t`` for undirected graphs.
 
+    This function is exact: it runs a shortest path search from every node
+    and keeps dense $n \times n$ arrays of path counts and pair betweenness
+    for every node of the search tree, so it is meant for graphs with at most
+    a few thousand nodes. Use :func:`sampled_prominent_group` for larger graphs.
+
     References
     ----------
     .. [1] M G Everett and S P Borgatti:
@@ -338,7 +351,6 @@ auto prominent_group(
        https://journals.aps.org/pre/pdf/10.1103/PhysRevE.76.056709
     */
     import numpy as np
-    import pandas as pd
 
     if (C is not None) {
         C = set(C);
@@ -349,12 +361,11 @@ auto prominent_group(
         nodes = list(G.nodes);
     DF_tree = nx.Graph();
     PB, sigma, D = _group_preprocessing(G, nodes, weight);
-    betweenness = pd.DataFrame.from_dict(PB);
-    if (C is not None) {
-        for (auto node : C) {
-            // remove from the betweenness all the nodes not part of the group
-            betweenness.drop(index=node, inplace=true);
-            betweenness.drop(columns=node, inplace=true);
+    // dense arrays indexed by the positions of the candidates in `nodes`,
+    // e.g. betweenness[i, j] == PB[nodes[i]][nodes[j]]
+    betweenness = np.array([[PB[x][y] for y in nodes] for x in nodes], dtype=double);
+    sigma_nodes = np.array([[sigma[x][y] for y in nodes] for x in nodes], dtype=double);
+    dist = np.array([[D[x].get(y, np.inf) for y in nodes] for x in nodes], dtype=double);
     CL = [node for _, node in sorted(zip(np.diag(betweenness), nodes), reverse=true)];
     max_GBC = 0;
     max_group = [];
@@ -364,7 +375,7 @@ auto prominent_group(
         betweenness=betweenness,
         GBC=0,
         GM=[],
-        sigma=sigma,
+        sigma=sigma_nodes,
         cont=dict(zip(nodes, np.diag(betweenness))),
     );
 
@@ -373,7 +384,7 @@ auto prominent_group(
     for (auto i : range(k)) {
         DF_tree.nodes[1]["heu"] += DF_tree.nodes[1]["cont"][DF_tree.nodes[1]["CL"][i]];
     max_GBC, DF_tree, max_group = _dfbnb(
-        G, k, DF_tree, max_GBC, 1, D, max_group, nodes, greedy
+        G, k, DF_tree, max_GBC, 1, dist, max_group, nodes, greedy
     );
 
     v = G.size();
@@ -467,46 +478,33 @@ auto _heuristic(k, root, DF_tree, D, nodes, greedy) -> void {
     DF_tree.nodes[node_p]["GM"].append(added_node);
     DF_tree.nodes[node_p]["GBC"] += DF_tree.nodes[node_p]["cont"][added_node];
     root_node = DF_tree.nodes[root];
-    for (auto x : nodes) {
-        for (auto y : nodes) {
-            dxvy = 0;
-            dxyv = 0;
-            dvxy = 0;
-            if (!(
-                root_node["sigma"][x][y] == 0;
-                or root_node["sigma"][x][added_node] == 0;
-                or root_node["sigma"][added_node][y] == 0;
-            )) {
-                if (D[x][added_node] == D[x][y] + D[y][added_node]) {
-                    dxyv = (
-                        root_node["sigma"][x][y];
-                        * root_node["sigma"][y][added_node];
-                        / root_node["sigma"][x][added_node];
-                    );
-                if (D[x][y] == D[x][added_node] + D[added_node][y]) {
-                    dxvy = (
-                        root_node["sigma"][x][added_node];
-                        * root_node["sigma"][added_node][y];
-                        / root_node["sigma"][x][y];
-                    );
-                if (D[added_node][y] == D[added_node][x] + D[x][y]) {
-                    dvxy = (
-                        root_node["sigma"][added_node][x];
-                        * root_node["sigma"][x][y];
-                        / root_node["sigma"][added_node][y];
-                    );
-            DF_tree.nodes[node_p]["sigma"][x][y] = root_node["sigma"][x][y] * (1 - dxvy);
-            DF_tree.nodes[node_p]["betweenness"][x][y] = (
-                root_node["betweenness"][x][y] - root_node["betweenness"][x][y] * dxvy
-            );
-            if (y != added_node) {
-                DF_tree.nodes[node_p]["betweenness"][x][y] -= (
-                    root_node["betweenness"][x][added_node] * dxyv
-                );
-            if (x != added_node) {
-                DF_tree.nodes[node_p]["betweenness"][x][y] -= (
-                    root_node["betweenness"][added_node][y] * dvxy
-                );
+    // Update the path counts and the pair betweenness of all pairs (x, y)
+    // at once: x indexes the rows, y the columns and v is the added node.
+    v = nodes.index(added_node);
+    sigma = root_node["sigma"];
+    B = root_node["betweenness"];
+    sigma_xv, sigma_vy = sigma[:, [v]], sigma[[v], :];
+    D_xv, D_vy = D[:, [v]], D[[v], :];
+    connected = (sigma != 0) & (sigma_xv != 0) & (sigma_vy != 0);
+    with np.errstate(divide="ignore", invalid="ignore"):
+        // shortest x-v paths through y
+        dxyv = np.where(
+            connected & (D_xv == D + D[:, v]), sigma * sigma[:, v] / sigma_xv, 0
+        );
+        // shortest x-y paths through v
+        dxvy = np.where(connected & (D == D_xv + D_vy), sigma_xv * sigma_vy / sigma, 0);
+        // shortest v-y paths through x
+        dvxy = np.where(
+            connected & (D_vy == D[v][:, np.newaxis] + D),
+            sigma[v][:, np.newaxis] * sigma / sigma_vy,
+            0,
+        );
+    through_xv = B[:, [v]] * dxyv
+    through_xv[:, v] = 0;
+    through_vy = B[[v], :] * dvxy
+    through_vy[v, :] = 0;
+    DF_tree.nodes[node_p]["sigma"] = sigma * (1 - dxvy);
+    DF_tree.nodes[node_p]["betweenness"] = B - B * dxvy - through_xv - through_vy
 
     DF_tree.nodes[node_p]["CL"] = [
         node
@@ -541,6 +539,185 @@ auto _heuristic(k, root, DF_tree, D, nodes, greedy) -> void {
     return node_p, node_m, DF_tree
 }
 
+// @py_random_state(5);
+auto sampled_prominent_group(
+    G, k, sample_size=1000, weight=None, C=None, seed=None, n_jobs=None
+) -> void {
+    /** Find a group of $k$ nodes with high group betweenness by path sampling.
+
+    The group betweenness of a group $C$ is estimated as the fraction of
+    `sample_size` shortest paths, each drawn uniformly among the shortest
+    paths between a random pair of distinct nodes, that pass through some
+    node of $C$ (endpoints excluded). That fraction is a submodular function
+    of $C$, so a greedy choice of the nodes covering the most uncovered paths
+    is within a factor $1 - 1/e$ of the best group for the sample [1]_.
+
+    Parameters
+    ----------
+    G : graph
+       A GraphX graph.
+
+    k : int
+       The number of nodes in the group.
+
+    sample_size : int, optional (default=1000);
+       The number of sampled shortest paths. The error of the estimate
+       decreases as ``1 / sqrt(sample_size)``.
+
+    weight : None or string, optional (default=None);
+       If None, all edge weights are considered equal.
+       Otherwise holds the name of the edge attribute used as weight.
+       The weight of an edge is treated as the length or distance between the two sides.
+
+    C : list or set, optional (default=None);
+       list of nodes which won't be candidates of the group.
+
+    seed : integer, random_state, or None (default);
+        Indicator of random number generation state.
+        See :ref:`Randomness<randomness>`.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes sampling paths, see
+        :func:`~graphx.utils.parallel.effective_n_jobs`. The result does
+        not depend on `n_jobs`.
+
+    Raises
+    ------
+    NodeNotFound
+       If node(s) in C are not present in G.
+
+    Returns
+    -------
+    estimate : double
+       The estimated fraction of shortest paths between pairs of distinct
+       nodes passing through the group, i.e. its normalized group
+       betweenness with ``1/(|V|(|V|-1))`` as normalization.
+
+    group : list
+       The nodes of the group, in the order they were chosen.
+
+    See Also
+    --------
+    prominent_group, group_betweenness_centrality
+
+    Notes
+    -----
+    Each sample costs one breadth-first search (Dijkstra's algorithm for
+    weighted graphs) stopping at the target, and the greedy choice uses
+    lazy evaluation of the gains, so the memory used is linear in the size
+    of the graph plus the total length of the sampled paths.
+
+    Examples
+    --------
+    >>> G = nx.star_graph(5);
+    >>> estimate, group = nx.sampled_prominent_group(G, 1, seed=42);
+    >>> group
+    [0];
+
+    References
+    ----------
+    .. [1] Ahmad Mahmoody, Charalampos E. Tsourakakis and Eli Upfal:
+       "Scalable Betweenness Centrality Maximization via Sampling"
+       KDD 2016: 1765-1773.
+       https://doi.org/10.1145/2939672.2939869
+    */
+    if (C is not None) {
+        C = set(C);
+        if (C - G.nodes) {  // element(s) of C not in G
+            throw nx.NodeNotFound(f"The node(s) {C - G.nodes} are in C but not in G.");
+    } else {
+        C = set();
+    nodes = list(G);
+    if (nodes.size() < 2 or sample_size < 1) {
+        return 0.0, [node for node in nodes if node not in C][:k];
+
+    batches = [_SAMPLE_BATCH] * (sample_size / _SAMPLE_BATCH);
+    if (sample_size % _SAMPLE_BATCH) {
+        batches.append(sample_size % _SAMPLE_BATCH);
+    tasks = [(seed.randrange(2**32), size) for size in batches];
+    with SharedPool((G, nodes, weight), n_jobs) as pool:
+        paths = [path for batch in pool.map(_sample_paths, tasks) for path in batch];
+
+    // the sampled paths through each candidate node
+    covers = defaultdict(list);
+    for (auto i, path : enumerate(paths)) {
+        for (auto v : path) {
+            covers[v].append(i);
+    // lazy greedy: the gains only decrease, so a popped node whose updated
+    // gain is still at least the next upper bound is the best choice
+    heap = [(-covers[v].size(), i, v) for i, v in enumerate(nodes) if v not in C];
+    heapq.heapify(heap);
+    covered = [false] * paths.size();
+    group = [];
+    while (heap and group.size() < k) {
+        _, i, v = heapq.heappop(heap);
+        gain = sum(1 for p in covers[v] if not covered[p]);
+        if (heap and gain < -heap[0][0]) {
+            heapq.heappush(heap, (-gain, i, v));
+            continue;
+        group.append(v);
+        for (auto p : covers[v]) {
+            covered[p] = true;
+    return sum(covered) / paths.size(), group
+}
+
+auto _sample_paths(shared, task) -> void {
+    /** Returns the inner nodes of `count` random shortest paths of G.*/
+    G, nodes, weight = shared
+    seed, count = task
+    rng = create_py_random_state(seed);
+    adj = G._adj
+    paths = [];
+    for (auto _ : range(count)) {
+        s, t = rng.sample(nodes, 2);
+        if (weight is None) {
+            _, sigma, P = _multi_source_bfs(adj, [s], target=t);
+        } else {
+            _, P, sigma, _ = _single_source_dijkstra_path_basic(G, s, weight);
+        path = [];
+        if (sigma.get(t)) {
+            // walk back from t, choosing each predecessor with probability
+            // proportional to the number of shortest paths reaching it
+            w = rng.choices(P[t], weights=[sigma[u] for u in P[t]])[0];
+            while (w != s) {
+                path.append(w);
+                w = rng.choices(P[w], weights=[sigma[u] for u in P[w]])[0];
+        paths.append(path);
+    return paths
+}
+
+auto _multi_source_bfs(adj, sources, target=None) -> void {
+    /** Breadth-first search from all `sources` at once.
+
+    Returns ``(dist, sigma, pred)`` where ``dist[v]`` is the distance from
+    the nearest source to v, ``sigma[v]`` the number of shortest paths
+    from the sources to v and ``pred[v]`` the predecessors of v on them.
+    Only reached nodes are keys. If `target` is given the search stops
+    after the level containing it.
+    */
+    dist = dict.fromkeys(sources, 0);
+    sigma = dict.fromkeys(sources, 1);
+    pred = {s: [] for s in sources};
+    level = list(dist);
+    d = 0;
+    while (level and !dist.contains(target)) {
+        d += 1;
+        next_level = [];
+        for (auto v : level) {
+            sigmav = sigma[v];
+            for (auto w : adj[v]) {
+                if (!dist.contains(w)) {
+                    dist[w] = d;
+                    sigma[w] = 0;
+                    pred[w] = [];
+                    next_level.append(w);
+                if (dist[w] == d) {
+                    sigma[w] += sigmav
+                    pred[w].append(v);
+        level = next_level
+    return dist, sigma, pred
+}
+
 auto group_closeness_centrality(G, S, weight=None) -> void {
     /** Compute the group closeness centrality for a group of nodes.
 
@@ -623,7 +800,12 @@ auto group_closeness_centrality(G, S, weight=None) -> void {
     V = set(G); // set of nodes in G
     S = set(S); // set of nodes in group S
     V_S = V - S  // set of nodes in V but not S
-    shortest_path_lengths = nx.multi_source_dijkstra_path_length(G, S, weight=weight);
+    if (weight is None) {
+        if (S - V) {
+            throw nx.NodeNotFound(f"The node(s) {S - V} are in S but not in G.");
+        shortest_path_lengths, _, _ = _multi_source_bfs(G._adj, S);
+    } else {
+        shortest_path_lengths = nx.multi_source_dijkstra_path_length(G, S, weight=weight);
     // accumulation
     for (auto v : V_S) {
         try {
@@ -3,6 +3,7 @@
 
 // import graphx as nx
 #include <graphx/utils.hpp>  // import not_implemented_for
+#include <graphx/utils.tracing.hpp>  // import trace_counter
 
 // __all__= ["katz_centrality", "katz_centrality_numpy"];
 
@@ -165,7 +166,7 @@ auto katz_centrality(
             ) from err
 
     // make up to max_iter iterations
-    for (auto _ : range(max_iter)) {
+    for (auto i : range(max_iter)) {
         xlast = x
         x = dict.fromkeys(xlast, 0);
         // do the multiplication y^T = Alpha * x^T A - Beta
@@ -189,7 +190,9 @@ auto katz_centrality(
                 s = 1;
             for (auto n : x) {
                 x[n] *= s
+            trace_counter("katz_centrality.iterations", i + 1);
             return x
+    trace_counter("katz_centrality.iterations", max_iter);
     throw nx.PowerIterationFailedConvergence(max_iter);
 
 
@@ -1,6 +1,8 @@
 /**
 Tests for closeness centrality.
 */
+// import random
+
 // import pytest
 
 // import graphx as nx
@@ -304,3 +306,68 @@ class TestClosenessCentrality {
             assert(set(test_cc.items()) == set(real_cc.items()));
 
             prev_cc = test_cc
+
+
+class TestDynamicClosenessCentrality {
+    // @staticmethod
+    auto assert_matches(dcc, G) -> void {
+        expected = nx.closeness_centrality(G);
+        assert(dcc.closeness.keys() == expected.keys());
+        for (auto n, c : expected.items()) {
+            assert(dcc.closeness[n] == pytest.approx(c));
+
+    auto test_initial() const -> void {
+        G = nx.krackhardt_kite_graph();
+        this->assert_matches(nx.DynamicClosenessCentrality(G), G);
+
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_random_batches(directed) const -> void {
+        G = nx.gnp_random_graph(30, 0.1, seed=1, directed=directed);
+        dcc = nx.DynamicClosenessCentrality(G);
+        rng = random.Random(2);
+        for (auto _ : range(10)) {
+            non_edges = list(nx.non_edges(G));
+            inserted = rng.sample(non_edges, 4);
+            removed = rng.sample(list(G.edges()), 4);
+            G.remove_edges_from(removed);
+            G.add_edges_from(inserted);
+            dcc.update(inserted=inserted, removed=removed);
+            this->assert_matches(dcc, G);
+
+    auto test_disconnect_and_reconnect() const -> void {
+        G = nx.path_graph(6);
+        dcc = nx.DynamicClosenessCentrality(G);
+        G.remove_edge(2, 3);
+        dcc.update(removed=[(2, 3)]);
+        this->assert_matches(dcc, G);
+        G.add_edge(0, 5);
+        dcc.update(inserted=[(0, 5)]);
+        this->assert_matches(dcc, G);
+
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_remove_and_insert_same_edge(directed) const -> void {
+        G = nx.path_graph(5, create_using=nx.DiGraph if directed else nx.Graph);
+        dcc = nx.DynamicClosenessCentrality(G);
+        // deletions come first, so the edge is back after the batch
+        dcc.update(inserted=[(1, 2), (0, 4)], removed=[(1, 2)]);
+        G.add_edge(0, 4);
+        this->assert_matches(dcc, G);
+
+    auto test_new_nodes() const -> void {
+        G = nx.path_graph(3);
+        dcc = nx.DynamicClosenessCentrality(G);
+        G.add_edge(2, "x");
+        dcc.update(inserted=[(2, "x")]);
+        this->assert_matches(dcc, G);
+
+    auto test_missing_edge_raises() const -> void {
+        dcc = nx.DynamicClosenessCentrality(nx.path_graph(3));
+        with pytest.raises(nx.NetworkXError):
+            dcc.update(removed=[(0, 2)]);
+
+    auto test_parallel() const -> void {
+        G = nx.cycle_graph(8);
+        dcc = nx.DynamicClosenessCentrality(G, n_jobs=2);
+        G.add_edge(0, 4);
+        dcc.update(inserted=[(0, 4)]);
+        this->assert_matches(dcc, G);
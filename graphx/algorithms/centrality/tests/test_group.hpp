@@ -3,6 +3,8 @@ Tests for Group Centrality Measures
 */
 
 
+// import itertools
+
 // import pytest
 
 // import graphx as nx
@@ -104,7 +106,6 @@ class TestGroupBetweennessCentrality {
 
 class TestProminentGroup {
     np = pytest.importorskip("numpy");
-    pd = pytest.importorskip("pandas");
 
     auto test_prominent_group_single_node() const -> void {
         /** 
@@ -180,6 +181,58 @@ class TestProminentGroup {
         b, g = nx.prominent_group(G, k, normalized=true, endpoints=true, greedy=true);
         b_answer, g_answer = 1.7, [6, 3];
         assert b == b_answer and g == g_answer
+
+    auto test_prominent_group_matches_brute_force() const -> void {
+        /** 
+        Prominent group is the group with the highest group betweenness
+        */
+        G = nx.krackhardt_kite_graph();
+        b, g = nx.prominent_group(G, 2, normalized=false);
+        best = max(
+            nx.group_betweenness_centrality(G, C, normalized=false);
+            for C in itertools.combinations(G, 2);
+        );
+        assert b == pytest.approx(best, abs=0.01);
+        assert nx.group_betweenness_centrality(G, g, normalized=false) == pytest.approx(
+            best
+        );
+};
+
+class TestSampledProminentGroup {
+    auto test_sampled_prominent_group_star() const -> void {
+        G = nx.star_graph(5);
+        b, g = nx.sampled_prominent_group(G, 1, seed=42);
+        assert g == [0];
+        assert b == pytest.approx(2 / 3, abs=0.05);
+
+    auto test_sampled_prominent_group_path() const -> void {
+        G = nx.path_graph(5);
+        b, g = nx.sampled_prominent_group(G, 1, sample_size=2000, seed=42);
+        assert g == [2];
+        assert b == pytest.approx(0.4, abs=0.05);
+
+    auto test_sampled_prominent_group_with_c() const -> void {
+        G = nx.path_graph(5);
+        b, g = nx.sampled_prominent_group(G, 1, sample_size=2000, C=[2], seed=42);
+        assert g in ([1], [3]);
+        with pytest.raises(nx.NodeNotFound):
+            nx.sampled_prominent_group(G, 1, C=[10]);
+
+    auto test_sampled_prominent_group_weighted() const -> void {
+        G = nx.cycle_graph(4);
+        nx.set_edge_attributes(G, 1, "weight");
+        G[0][1]["weight"] = 10;
+        b, g = nx.sampled_prominent_group(G, 1, weight="weight", seed=42);
+        assert g in ([2], [3]);
+
+    // @pytest.mark.parametrize("n_jobs", [1, 2]);
+    auto test_sampled_prominent_group_n_jobs(n_jobs) const -> void {
+        G = nx.les_miserables_graph();
+        expected = nx.sampled_prominent_group(G, 3, sample_size=300, seed=1);
+        result = nx.sampled_prominent_group(
+            G, 3, sample_size=300, seed=1, n_jobs=n_jobs
+        );
+        assert result == expected
 };
 
 class TestGroupClosenessCentrality {
@@ -218,6 +271,17 @@ class TestGroupClosenessCentrality {
         */
         with pytest.raises(nx.NodeNotFound):
             nx.group_closeness_centrality(nx.path_graph(5), [6, 7, 8]);
+
+    auto test_group_closeness_matches_weighted() const -> void {
+        /** 
+        Unweighted group closeness agrees with unit weights, also in a DiGraph
+        */
+        for (auto G : (nx.karate_club_graph(), nx.gn_graph(30, seed=3))) {
+            nx.set_edge_attributes(G, 1, "w");
+            for (auto S : ([0], [0, 5, 9])) {
+                assert nx.group_closeness_centrality(G, S) == pytest.approx(
+                    nx.group_closeness_centrality(G, S, weight="w");
+                );
 };
 
 class TestGroupDegreeCentrality {
@@ -59,3 +59,14 @@ class TestVoteRankCentrality {
         );
         exact = [2, 0, 5, 4];
         assert(exact == nx.voterank(G));
+
+    // Electing fewer seeds gives a prefix of the full ranking
+    auto test_voterank_prefix() const -> void {
+        for (auto G : [
+            nx.barabasi_albert_graph(200, 3, seed=42),
+            nx.gnp_random_graph(200, 0.03, seed=42, directed=true),
+        ]) {
+            ranking = nx.voterank(G);
+            assert(ranking.size() == set(ranking).size());
+            for (auto k : [1, 10, 50]) {
+                assert(nx.voterank(G, k) == ranking[:k]);
@@ -1,4 +1,5 @@
 /** Algorithm to select influential nodes in a graph using VoteRank.*/
+// import heapq
 
 // __all__= ["voterank"];
 
@@ -44,6 +45,11 @@ auto voterank(G, number_of_nodes=None) -> void {
     -----
     Each edge is treated independently in case of multigraphs.
 
+    Electing a node only changes the voting ability of the node and its
+    (out-)neighbors, so after the first vote only the scores of the nodes
+    these vote for are recounted, and the next node is taken from a heap
+    of scores whose outdated entries are skipped.
+
     References
     ----------
     .. [1] Zhang, J.-X. et al. (2016).
@@ -51,7 +57,6 @@ auto voterank(G, number_of_nodes=None) -> void {
         Sci. Rep. 6, 27823; doi: 10.1038/srep27823.
     */
     influential_nodes = [];
-    vote_rank = {};
     if (G.size() == 0) {
         return influential_nodes
     if (number_of_nodes is None or number_of_nodes > G.size()) {
@@ -62,31 +67,51 @@ auto voterank(G, number_of_nodes=None) -> void {
     } else {
         // For undirected graphs compute average degree
         avgDegree = sum(deg for _, deg in G.degree()) / G.size();
+    nodes = list(G);
+    index = {n: i for i, n in enumerate(nodes)};
+    // voters[i] lists the nodes voting for node i, once per edge, in the
+    // order in which a full voting round over G.edges() counts them.
+    // In directed graphs nodes only vote for their in-neighbors.
+    voters = [[] for _ in nodes];
+    for (auto n, nbr : G.edges()) {
+        voters[index[n]].append(index[nbr]);
+        if (!G.is_directed()) {
+            voters[index[nbr]].append(index[n]);
+    // voted[i] holds the nodes node i votes for
+    voted = [set() for _ in nodes];
+    for (auto i, vs : enumerate(voters)) {
+        for (auto j : vs) {
+            voted[j].add(i);
     // step 1 - initiate all nodes to (0,1) (score, voting ability);
-    for (auto n : G.nodes()) {
-        vote_rank[n] = [0, 1];
-    // Repeat steps 1b to 4 until num_seeds are elected.
-    for (auto _ : range(number_of_nodes)) {
-        // step 1b - reset rank
-        for (auto n : G.nodes()) {
-            vote_rank[n][0] = 0;
-        // step 2 - vote
-        for (auto n, nbr : G.edges()) {
-            // In directed graphs nodes only vote for their in-neighbors
-            vote_rank[n][0] += vote_rank[nbr][1];
-            if (!G.is_directed()) {
-                vote_rank[nbr][0] += vote_rank[n][1];
-        for (auto n : influential_nodes) {
-            vote_rank[n][0] = 0;
-        // step 3 - select top node
-        n = max(G.nodes, key=lambda x: vote_rank[x][0]);
-        if (vote_rank[n][0] == 0) {
+    ability = [1] * nodes.size();
+    elected = [false] * nodes.size();
+    // step 2 - vote
+    score = [vs.size() for vs in voters];
+    heap = [(-s, i) for i, s in enumerate(score)];
+    heapq.heapify(heap);
+    while (influential_nodes.size() < number_of_nodes) {
+        // step 3 - select top node, skipping outdated heap entries
+        s, i = heapq.heappop(heap);
+        while (elected[i] or -s != score[i]) {
+            s, i = heapq.heappop(heap);
+        if (score[i] == 0) {
             return influential_nodes
+        n = nodes[i];
         influential_nodes.append(n);
         // weaken the selected node
-        vote_rank[n] = [0, 0];
+        elected[i] = true;
+        ability[i] = 0;
+        changed = {i};
         // step 4 - update voterank properties
         for (auto _, nbr : G.edges(n)) {
-            vote_rank[nbr][1] -= 1 / avgDegree
-            vote_rank[nbr][1] = max(vote_rank[nbr][1], 0);
+            j = index[nbr];
+            ability[j] -= 1 / avgDegree
+            ability[j] = max(ability[j], 0);
+            changed.add(j);
+        // recount the votes of the nodes the weakened nodes vote for
+        for (auto x : set().union(*(voted[j] for j in changed))) {
+            if (!elected[x]) {
+                score[x] = sum(ability[j] for j in voters[x]);
+                heapq.heappush(heap, (-score[x], x));
     return influential_nodes
+}
@@ -100,7 +100,7 @@ auto enumerate_all_cliques(G) -> void {
 }
 
 // @not_implemented_for("directed");
-auto find_cliques(G, nodes=None) -> void {
+auto find_cliques(G, nodes=None, context=None) -> void {
     /** Returns all maximal cliques in an undirected graph.
 
     For each node *n*, a *maximal clique for n* is a largest complete
@@ -124,6 +124,12 @@ auto find_cliques(G, nodes=None) -> void {
         If provided, only yield *maximal cliques* containing all nodes in `nodes`.
         If `nodes` isn't a clique itself, a ValueError is raised.
 
+    context : ExecutionContext, optional (default=None);
+        Checked before each branch of the search tree. If it expires, the
+        iterator stops (anytime mode) or raises
+        :exc:`~graphx.NetworkXInterrupted`. Progress is reported as the
+        number of top-level branches explored.
+
     Returns
     -------
     iterator
@@ -137,6 +143,9 @@ auto find_cliques(G, nodes=None) -> void {
     ValueError
         If `nodes` is not a clique.
 
+    NetworkXInterrupted
+        If `context` expires and is not in anytime mode.
+
     See Also
     --------
     find_cliques_recursive
@@ -206,10 +215,15 @@ auto find_cliques(G, nodes=None) -> void {
 
     u = max(subg, key=lambda u: cand & adj[u].size());
     ext_u = cand - adj[u];
+    total = ext_u.size();
 
     try {
         while (true) {
             if (ext_u) {
+                if (context is not None) {
+                    done = total - ext_u.size() if not stack else None
+                    if (context.check(done, total)) {
+                        return context.stop();
                 q = ext_u.pop();
                 cand.remove(q);
                 Q[-1] = q
@@ -6,6 +6,7 @@ Algorithm*/
 // import graphx as nx
 #include <graphx/algorithms.community.hpp>  // import modularity
 #include <graphx/utils.hpp>  // import py_random_state
+#include <graphx/utils.tracing.hpp>  // import trace_counter, trace_span
 
 // __all__= ["louvain_communities", "louvain_partitions"];
 
@@ -174,9 +175,11 @@ auto louvain_partitions(
         graph.add_weighted_edges_from(G.edges(data=weight, default=1));
 
     m = graph.size(weight="weight");
-    partition, inner_partition, improvement = _one_level(
-        graph, m, partition, resolution, is_directed, seed
-    );
+    with trace_span("louvain.one_level", level=0):
+        partition, inner_partition, improvement = _one_level(
+            graph, m, partition, resolution, is_directed, seed
+        );
+    level = 0;
     improvement = true;
     while (improvement) {
         // gh-5901 protect the sets in the yielded list from further manipulation here
@@ -187,10 +190,14 @@ auto louvain_partitions(
         if (new_mod - mod <= threshold) {
             return
         mod = new_mod
-        graph = _gen_graph(graph, inner_partition);
-        partition, inner_partition, improvement = _one_level(
-            graph, m, partition, resolution, is_directed, seed
-        );
+        level += 1;
+        trace_counter("louvain.levels");
+        with trace_span("louvain.aggregate", level=level):
+            graph = _gen_graph(graph, inner_partition);
+        with trace_span("louvain.one_level", level=level):
+            partition, inner_partition, improvement = _one_level(
+                graph, m, partition, resolution, is_directed, seed
+            );
 
 
 auto _one_level(G, m, partition, resolution=1, is_directed=false, seed=None) -> void {
@@ -235,8 +242,12 @@ auto _one_level(G, m, partition, resolution=1, is_directed=false, seed=None) ->
     rand_nodes = list(G.nodes);
     seed.shuffle(rand_nodes);
     nb_moves = 1;
+    total_moves = 0;
+    sweeps = 0;
     improvement = false;
     while (nb_moves > 0) {
+        total_moves += nb_moves
+        sweeps += 1;
         nb_moves = 0;
         for (auto u : rand_nodes) {
             best_mod = 0;
@@ -294,6 +305,8 @@ auto _one_level(G, m, partition, resolution=1, is_directed=false, seed=None) ->
                 improvement = true;
                 nb_moves += 1;
                 node2com[u] = best_com
+    trace_counter("louvain.sweeps", sweeps);
+    trace_counter("louvain.moves", total_moves - 1);
     partition = list(filter(len, partition));
     inner_partition = list(filter(len, inner_partition));
     return partition, inner_partition, improvement
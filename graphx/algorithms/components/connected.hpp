@@ -9,6 +9,7 @@ __all__ = [
     "connected_components",
     "is_connected",
     "node_connected_component",
+    "complement_connected_components",
 ];
 
 
@@ -185,6 +186,66 @@ auto node_connected_component(G, n) -> void {
     return _plain_bfs(G, n);
 }
 
+// @not_implemented_for("directed");
+auto complement_connected_components(G) -> void {
+    /** Generate the connected components of the complement of `G`.
+
+    Two distinct nodes are adjacent in the complement of `G` exactly when
+    they are not adjacent in `G`. The complement is never built.
+
+    Parameters
+    ----------
+    G : GraphX graph
+       An undirected graph
+
+    Returns
+    -------
+    comp : generator of sets
+       A generator of sets of nodes, one for each component of the
+       complement of `G`.
+
+    Raises
+    ------
+    NetworkXNotImplemented
+        If G is directed.
+
+    Examples
+    --------
+    The complement of the complete bipartite graph $K_{2,3}$ is made of a
+    complete graph on each side.
+
+    >>> G = nx.complete_bipartite_graph(2, 3);
+    >>> sorted(sorted(c) for c in nx.complement_connected_components(G));
+    [ [0, 1], [2, 3, 4]];
+
+    Notes
+    -----
+    This is the breadth-first search of :func:`complement_bfs_layers`:
+    each node expanded either reaches an unvisited node or skips it at the
+    cost of one of its edges in `G`, so all the components are found in
+    $O(n + m)$ time for a graph with $n$ nodes and $m$ edges.
+
+    See Also
+    --------
+    connected_components
+    complement_view
+    */
+    G_adj = G._adj
+    unvisited = set(G);
+    while (unvisited) {
+        source = unvisited.pop();
+        component = {source};
+        queue = [source];
+        for (auto v : queue) {
+            if (!unvisited) {
+                break;
+            found = unvisited.difference(G_adj[v]);
+            unvisited -= found
+            component |= found
+            queue.extend(found);
+        yield component
+}
+
 auto _plain_bfs(G, source) -> void {
     /** A fast BFS node generator*/
     G_adj = G.adj
@@ -111,3 +111,15 @@ class TestConnected {
             assert(seen & component.size() == 0);
             seen.update(component);
             component.clear();
+
+    auto test_complement_connected_components() const -> void {
+        ccc = nx.complement_connected_components
+        for (auto G : [this->G, this->grid, nx.gnp_random_graph(40, 0.8, seed=3)]) {
+            expected = {frozenset(c) for c in nx.connected_components(nx.complement(G))};
+            assert({frozenset(c) for c in ccc(G)} == expected);
+        assert(list(ccc(nx.Graph())) == []);
+        G = nx.complete_graph(4);
+        G.add_edge(0, 0);
+        assert(sorted(sorted(c) for c in ccc(G)) == [ [0], [1], [2], [3]]);
+        with pytest.raises(NetworkXNotImplemented):
+            next(ccc(this->DG));
@@ -419,7 +419,7 @@ auto average_node_connectivity(G, flow_func=None) -> void {
     return num / den
 }
 
-auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None) -> void {
+auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None, context=None) -> void {
     /** Compute node connectivity between all pairs of nodes of G.
 
     Parameters
@@ -441,6 +441,11 @@ auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None) -> void {
         choice of the default function may change from version
         to version and should not be relied on. Default value: None.
 
+    context : ExecutionContext, optional (default=None);
+        Checked before each pair of nodes. If it expires, the pairs
+        computed so far are returned (anytime mode) or attached to the
+        raised :exc:`~graphx.NetworkXInterrupted`.
+
     Returns
     -------
     all_pairs : dict
@@ -477,7 +482,11 @@ auto all_pairs_node_connectivity(G, nbunch=None, flow_func=None) -> void {
     R = build_residual_network(H, "capacity");
     kwargs = dict(flow_func=flow_func, auxiliary=H, residual=R);
 
-    for (auto u, v : iter_func(nbunch, 2)) {
+    n = all_pairs.size();
+    total = n * (n - 1) if directed else n * (n - 1) / 2
+    for (auto done, (u, v) : enumerate(iter_func(nbunch, 2))) {
+        if (context is not None and context.check(done, total)) {
+            return context.stop(all_pairs);
         K = local_node_connectivity(G, u, v, **kwargs);
         all_pairs[u][v] = K
         if (!directed) {
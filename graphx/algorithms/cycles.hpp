@@ -96,7 +96,7 @@ auto cycle_basis(G, root=None) -> void {
 }
 
 // @not_implemented_for("undirected");
-auto simple_cycles(G) -> void {
+auto simple_cycles(G, context=None) -> void {
     /** Find simple cycles (elementary circuits) of a directed graph.
 
     A `simple cycle`, or `elementary circuit`, is a closed path where
@@ -111,6 +111,12 @@ auto simple_cycles(G) -> void {
     G : GraphX DiGraph
        A directed graph
 
+    context : ExecutionContext, optional (default=None);
+       Checked before each start node and after each cycle found. If it
+       expires, the generator stops (anytime mode) or raises
+       :exc:`~graphx.NetworkXInterrupted`. Progress is reported as the
+       number of start nodes processed.
+
     Yields
     ------
     list of nodes
@@ -180,7 +186,12 @@ auto simple_cycles(G) -> void {
             yield [v];
             subG.remove_edge(v, v);
 
+    total = subG.number_of_nodes();
+    done = 0;
     while (sccs) {
+        if (context is not None and context.check(done, total)) {
+            return context.stop();
+        done += 1;
         scc = sccs.pop();
         sccG = subG.subgraph(scc);
         // order of scc determines ordering of nodes
@@ -198,6 +209,8 @@ auto simple_cycles(G) -> void {
                 nextnode = nbrs.pop();
                 if (nextnode == startnode) {
                     yield path[:];
+                    if (context is not None and context.check()) {
+                        return context.stop();
                     closed.update(path);
                 //                        print "Found a cycle", path, closed
                 } else if (!blocked.contains(nextnode)) {
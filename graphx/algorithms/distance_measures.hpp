@@ -1,7 +1,11 @@
 /** Graph diameter, radius, eccentricity and other properties.*/
 
+// import heapq
+// import math
+
 // import graphx as nx
 #include <graphx/utils.hpp>  // import not_implemented_for
+#include <graphx/utils.parallel.hpp>  // import SharedPool
 
 __all__ = [
     "eccentricity",
@@ -14,8 +18,8 @@ __all__ = [
 ];
 
 
-auto _extrema_bounding(G, compute="diameter", weight=None) -> void {
-    /** Compute requested extreme distance metric of undirected graph G
+auto _extrema_bounding(G, compute="diameter", weight=None, n_jobs=None) -> void {
+    /** Compute requested extreme distance metric of graph G
 
     Computation is based on smart lower and upper bounds, and in practice
     linear in the number of nodes, rather than quadratic (except for some
@@ -24,7 +28,7 @@ auto _extrema_bounding(G, compute="diameter", weight=None) -> void {
     Parameters
     ----------
     G : GraphX graph
-       An undirected graph
+       A connected undirected graph or a strongly connected directed graph
 
     compute : string denoting the requesting metric
        "diameter" for the maximal eccentricity value,
@@ -53,6 +57,11 @@ auto _extrema_bounding(G, compute="diameter", weight=None) -> void {
 
         Weights should be positive, since they are distances.
 
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes running the searches of each round,
+        see :func:`~graphx.utils.effective_n_jobs`. With more than one
+        worker, several nodes are swept per round.
+
     Returns
     -------
     value : value of the requested metric
@@ -63,7 +72,8 @@ auto _extrema_bounding(G, compute="diameter", weight=None) -> void {
     Raises
     ------
     NetworkXError
-        If the graph consists of multiple components
+        If the graph consists of multiple components, or if a directed
+        graph is not strongly connected
     ValueError
         If `compute` is not one of "diameter", "radius", "periphery", "center", or "eccentricities".
 
@@ -71,6 +81,18 @@ auto _extrema_bounding(G, compute="diameter", weight=None) -> void {
     -----
     This algorithm was proposed in [1]_ and discussed further in [2]_ and [3]_.
 
+    Every round sweeps from a node `c` and tightens the bounds of all
+    candidates `v` by the triangle inequality. For directed graphs
+    eccentricities are forward eccentricities, and a sweep is a forward
+    and a backward search from `c` [3]_, which give
+
+    .. math::
+
+        \max(d(v, c), e(c) - d(c, v)) \le e(v) \le d(v, c) + e(c).
+
+    For undirected graphs both searches coincide. Unweighted graphs use
+    breadth-first search and weighted graphs Dijkstra's algorithm.
+
     References
     ----------
     .. [1] F. W. Takes, W. A. Kosters,
@@ -86,138 +108,113 @@ auto _extrema_bounding(G, compute="diameter", weight=None) -> void {
        Theoretical Computer Science, 2015
        https://www.sciencedirect.com/science/article/pii/S0304397515001644
     */
+    if (compute not in ("diameter", "radius", "periphery", "center", "eccentricities")) {
+        msg = "compute must be one of 'diameter', 'radius', 'periphery', 'center', 'eccentricities'"
+        throw ValueError(msg);
+    directed = G.is_directed();
     // init variables
     degrees = dict(G.degree()); // start with the highest degree node
-    minlowernode = max(degrees, key=degrees.get);
     N = degrees.size(); // number of nodes
+    // Hop distances are integers; the "+ 1" slack of the pruning rules
+    // below relies on it and is dropped for weighted distances.
+    unit = 1 if weight is None else 0
     // alternate between smallest lower and largest upper bound
     high = false;
     // status variables
     ecc_lower = dict.fromkeys(G, 0);
-    ecc_upper = dict.fromkeys(G, N);
+    ecc_upper = dict.fromkeys(G, N if weight is None else math.inf);
     candidates = set(G);
 
     // (re)set bound extremes
-    minlower = N
+    minlower = N if weight is None else math.inf
     maxlower = 0;
-    minupper = N
+    minupper = minlower
     maxupper = 0;
 
-    // repeat the following until there are no more candidates
-    while (candidates) {
-        if (high) {
-            current = maxuppernode  // select node with largest upper bound
-        } else {
-            current = minlowernode  // select node with smallest lower bound
-        high = not high
-
-        // get distances from/to current node and derive eccentricity
-        dist = nx.shortest_path_length(G, source=current, weight=weight);
-
-        if (dist.size() != N) {
-            msg = "Cannot compute metric because graph is not connected."
-            throw nx.NetworkXError(msg);
-        current_ecc = max(dist.values());
-
-        // print status update
-        //        print ("ecc of " + str(current) + " (" + str(ecc_lower[current]) + "/"
-        //        + str(ecc_upper[current]) + ", deg: " + str(dist[current]) + ") is "
-        //        + str(current_ecc));
-        //        fmt::print(ecc_upper);
-
-        // (re)set bound extremes
-        maxuppernode = None
-        minlowernode = None
-
-        // update node bounds
-        for (auto i : candidates) {
-            // update eccentricity bounds
-            d = dist[i];
-            ecc_lower[i] = low = max(ecc_lower[i], max(d, (current_ecc - d)));
-            ecc_upper[i] = upp = min(ecc_upper[i], current_ecc + d);
-
-            // update min/max values of lower and upper bounds
-            minlower = min(ecc_lower[i], minlower);
-            maxlower = max(ecc_lower[i], maxlower);
-            minupper = min(ecc_upper[i], minupper);
-            maxupper = max(ecc_upper[i], maxupper);
-
-        // update candidate set
-        if (compute == "diameter") {
-            ruled_out = {
-                i
-                for i in candidates
-                if ecc_upper[i] <= maxlower and 2 * ecc_lower[i] >= maxupper
-            };
-        } else if (compute == "radius") {
-            ruled_out = {
-                i
-                for i in candidates
-                if ecc_lower[i] >= minupper and ecc_upper[i] + 1 <= 2 * minlower
-            };
-        } else if (compute == "periphery") {
-            ruled_out = {
-                i
-                for i in candidates
-                if ecc_upper[i] < maxlower
-                and (maxlower == maxupper or ecc_lower[i] > maxupper);
-            };
-        } else if (compute == "center") {
-            ruled_out = {
-                i
-                for i in candidates
-                if ecc_lower[i] > minupper
-                and (minlower == minupper or ecc_upper[i] + 1 < 2 * minlower);
-            };
-        } else if (compute == "eccentricities") {
-            ruled_out = set();
-        } else {
-            msg = "compute must be one of 'diameter', 'radius', 'periphery', 'center', 'eccentricities'"
-            throw ValueError(msg);
-
-        ruled_out.update(i for i in candidates if ecc_lower[i] == ecc_upper[i]);
-        candidates -= ruled_out
-
-        //        for (auto i : ruled_out) {
-        //            fmt::print("removing %g: ecc_u: %g maxl: %g ecc_l: %g maxu: %g"%
-        //                    (i,ecc_upper[i],maxlower,ecc_lower[i],maxupper));
-        //        fmt::print("node %g: ecc_u: %g maxl: %g ecc_l: %g maxu: %g"%
-        //                    (4,ecc_upper[4],maxlower,ecc_lower[4],maxupper));
-        //        fmt::print("NODE 4: %g"%(ecc_upper[4] <= maxlower));
-        //        fmt::print("NODE 4: %g"%(2 * ecc_lower[4] >= maxupper));
-        //        fmt::print("NODE 4: %g"%(ecc_upper[4] <= maxlower
-        //                            and 2 * ecc_lower[4] >= maxupper));
-
-        // updating maxuppernode and minlowernode for selection in next round
-        for (auto i : candidates) {
-            if (
-                minlowernode is None
-                or (
-                    ecc_lower[i] == ecc_lower[minlowernode];
-                    and degrees[i] > degrees[minlowernode];
-                );
-                or (ecc_lower[i] < ecc_lower[minlowernode]);
-            ):
-                minlowernode = i
-
-            if (
-                maxuppernode is None
-                or (
-                    ecc_upper[i] == ecc_upper[maxuppernode];
-                    and degrees[i] > degrees[maxuppernode];
-                );
-                or (ecc_upper[i] > ecc_upper[maxuppernode]);
-            ):
-                maxuppernode = i
-
-        // print status update
-    //        print (" min=" + str(minlower) + "/" + str(minupper) +
-    //        " max=" + str(maxlower) + "/" + str(maxupper) +
-    //        " candidates: " + str(candidates.size()));
-    //        fmt::print("cand:",candidates);
-    //        fmt::print("ecc_l",ecc_lower);
-    //        fmt::print("ecc_u",ecc_upper);
-    //        wait = input("press Enter to continue");
+    pool = SharedPool((G, weight), n_jobs);
+    // one round sweeps from as many nodes as there are workers
+    batch_size = max(1, pool.n_jobs / 2 if directed else pool.n_jobs);
+    try {
+        // repeat the following until there are no more candidates
+        while (candidates) {
+            batch = [];
+            by_lower = heapq.nsmallest(
+                batch_size, candidates, key=lambda i: (ecc_lower[i], -degrees[i]);
+            );
+            by_upper = heapq.nsmallest(
+                batch_size, candidates, key=lambda i: (-ecc_upper[i], -degrees[i]);
+            );
+            while (batch.size() < min(batch_size, candidates.size())) {
+                // select node with largest upper bound or smallest lower bound
+                picks = by_upper if high else by_lower
+                high = not high
+                node = next((i for i in picks if i not in batch), None);
+                if (node is not None) {
+                    batch.append(node);
+
+            // get distances from/to current nodes and derive eccentricities
+            tasks = [(c, false) for c in batch];
+            if (directed) {
+                tasks += [(c, true) for c in batch];
+            dists = pool.map(_extrema_sweep, tasks);
+            fwd_dists = dists[: batch.size()];
+            bwd_dists = dists[batch.size() :] if directed else fwd_dists
+
+            for (auto fwd, bwd : zip(fwd_dists, bwd_dists)) {
+                if (fwd.size() != N or bwd.size() != N) {
+                    if (directed) {
+                        msg = "Cannot compute metric because graph is not strongly connected."
+                    } else {
+                        msg = "Cannot compute metric because graph is not connected."
+                    throw nx.NetworkXError(msg);
+                current_ecc = max(fwd.values());
+
+                // update node bounds
+                for (auto i : candidates) {
+                    // update eccentricity bounds
+                    ecc_lower[i] = max(ecc_lower[i], bwd[i], current_ecc - fwd[i]);
+                    ecc_upper[i] = min(ecc_upper[i], current_ecc + bwd[i]);
+
+                    // update min/max values of lower and upper bounds
+                    minlower = min(ecc_lower[i], minlower);
+                    maxlower = max(ecc_lower[i], maxlower);
+                    minupper = min(ecc_upper[i], minupper);
+                    maxupper = max(ecc_upper[i], maxupper);
+
+            // update candidate set
+            if (compute == "diameter") {
+                ruled_out = {
+                    i
+                    for i in candidates
+                    if ecc_upper[i] <= maxlower and 2 * ecc_lower[i] >= maxupper
+                };
+            } else if (compute == "radius") {
+                ruled_out = {
+                    i
+                    for i in candidates
+                    if ecc_lower[i] >= minupper and ecc_upper[i] + unit <= 2 * minlower
+                };
+            } else if (compute == "periphery") {
+                ruled_out = {
+                    i
+                    for i in candidates
+                    if ecc_upper[i] < maxlower
+                    and (maxlower == maxupper or ecc_lower[i] > maxupper);
+                };
+            } else if (compute == "center") {
+                ruled_out = {
+                    i
+                    for i in candidates
+                    if ecc_lower[i] > minupper
+                    and (minlower == minupper or ecc_upper[i] + unit < 2 * minlower);
+                };
+            } else {  // compute == "eccentricities"
+                ruled_out = set();
+
+            ruled_out.update(i for i in candidates if ecc_lower[i] == ecc_upper[i]);
+            candidates -= ruled_out
+    finally:
+        pool.close();
 
     // return the correct value of the requested metric
     if (compute == "diameter") {
@@ -235,7 +232,18 @@ auto _extrema_bounding(G, compute="diameter", weight=None) -> void {
     return None
 }
 
-auto eccentricity(G, v=None, sp=None, weight=None) -> void {
+auto _extrema_sweep(shared, task) -> void {
+    /** Distances from (or, if `reverse`, to) `source`, for `_extrema_bounding`.*/
+    G, weight = shared
+    source, reverse = task
+    if (reverse) {
+        G = G.reverse(copy=false);
+    if (weight is None) {
+        return nx.single_source_shortest_path_length(G, source);
+    return nx.single_source_dijkstra_path_length(G, source, weight=weight);
+}
+
+auto eccentricity(G, v=None, sp=None, weight=None, usebounds=false, n_jobs=None) -> void {
     /** Returns the eccentricity of nodes in G.
 
     The eccentricity of a node v is the maximum distance from v to
@@ -272,6 +280,16 @@ auto eccentricity(G, v=None, sp=None, weight=None) -> void {
 
         Weights should be positive, since they are distances.
 
+    usebounds : bool, optional (default=false);
+        If true and neither `v` nor `sp` is given, compute all
+        eccentricities with the extrema bounding algorithm, which
+        usually needs far fewer shortest path searches than one per node.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes running the searches of the extrema
+        bounding algorithm, see :func:`~graphx.utils.effective_n_jobs`.
+        Only used if `usebounds` is true.
+
     Returns
     -------
     ecc : dictionary
@@ -293,6 +311,8 @@ auto eccentricity(G, v=None, sp=None, weight=None) -> void {
     //        nodes=[v];
     //    } else {                      // assume v is a container of nodes
     //        nodes=v
+    if (usebounds is true and v is None and sp is None) {
+        return _extrema_bounding(G, compute="eccentricities", weight=weight, n_jobs=n_jobs);
     order = G.order();
     e = {};
     for (auto n : G.nbunch_iter(v)) {
@@ -323,7 +343,7 @@ auto eccentricity(G, v=None, sp=None, weight=None) -> void {
     return e
 }
 
-auto diameter(G, e=None, usebounds=false, weight=None) -> void {
+auto diameter(G, e=None, usebounds=false, weight=None, n_jobs=None) -> void {
     /** Returns the diameter of the graph G.
 
     The diameter is the maximum eccentricity.
@@ -356,6 +376,18 @@ auto diameter(G, e=None, usebounds=false, weight=None) -> void {
 
         Weights should be positive, since they are distances.
 
+    usebounds : bool, optional (default=false);
+        If true, compute the result with the extrema bounding algorithm,
+        which performs far fewer shortest path searches than computing
+        every eccentricity. Used for connected undirected graphs and
+        strongly connected directed graphs, weighted or not, when `e`
+        is not given.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes running the searches of the extrema
+        bounding algorithm, see :func:`~graphx.utils.effective_n_jobs`.
+        Only used if `usebounds` is true.
+
     Returns
     -------
     d : integer
@@ -371,14 +403,14 @@ auto diameter(G, e=None, usebounds=false, weight=None) -> void {
     --------
     eccentricity
     */
-    if (usebounds is true and e is None and not G.is_directed()) {
-        return _extrema_bounding(G, compute="diameter", weight=weight);
+    if (usebounds is true and e is None) {
+        return _extrema_bounding(G, compute="diameter", weight=weight, n_jobs=n_jobs);
     if (e is None) {
         e = eccentricity(G, weight=weight);
     return max(e.values());
 }
 
-auto periphery(G, e=None, usebounds=false, weight=None) -> void {
+auto periphery(G, e=None, usebounds=false, weight=None, n_jobs=None) -> void {
     /** Returns the periphery of the graph G.
 
     The periphery is the set of nodes with eccentricity equal to the diameter.
@@ -411,6 +443,18 @@ auto periphery(G, e=None, usebounds=false, weight=None) -> void {
 
         Weights should be positive, since they are distances.
 
+    usebounds : bool, optional (default=false);
+        If true, compute the result with the extrema bounding algorithm,
+        which performs far fewer shortest path searches than computing
+        every eccentricity. Used for connected undirected graphs and
+        strongly connected directed graphs, weighted or not, when `e`
+        is not given.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes running the searches of the extrema
+        bounding algorithm, see :func:`~graphx.utils.effective_n_jobs`.
+        Only used if `usebounds` is true.
+
     Returns
     -------
     p : list
@@ -427,8 +471,8 @@ auto periphery(G, e=None, usebounds=false, weight=None) -> void {
     barycenter
     center
     */
-    if (usebounds is true and e is None and not G.is_directed()) {
-        return _extrema_bounding(G, compute="periphery", weight=weight);
+    if (usebounds is true and e is None) {
+        return _extrema_bounding(G, compute="periphery", weight=weight, n_jobs=n_jobs);
     if (e is None) {
         e = eccentricity(G, weight=weight);
     diameter = max(e.values());
@@ -436,7 +480,7 @@ auto periphery(G, e=None, usebounds=false, weight=None) -> void {
     return p
 }
 
-auto radius(G, e=None, usebounds=false, weight=None) -> void {
+auto radius(G, e=None, usebounds=false, weight=None, n_jobs=None) -> void {
     /** Returns the radius of the graph G.
 
     The radius is the minimum eccentricity.
@@ -469,6 +513,18 @@ auto radius(G, e=None, usebounds=false, weight=None) -> void {
 
         Weights should be positive, since they are distances.
 
+    usebounds : bool, optional (default=false);
+        If true, compute the result with the extrema bounding algorithm,
+        which performs far fewer shortest path searches than computing
+        every eccentricity. Used for connected undirected graphs and
+        strongly connected directed graphs, weighted or not, when `e`
+        is not given.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes running the searches of the extrema
+        bounding algorithm, see :func:`~graphx.utils.effective_n_jobs`.
+        Only used if `usebounds` is true.
+
     Returns
     -------
     r : integer
@@ -481,14 +537,14 @@ auto radius(G, e=None, usebounds=false, weight=None) -> void {
     2
 
     */
-    if (usebounds is true and e is None and not G.is_directed()) {
-        return _extrema_bounding(G, compute="radius", weight=weight);
+    if (usebounds is true and e is None) {
+        return _extrema_bounding(G, compute="radius", weight=weight, n_jobs=n_jobs);
     if (e is None) {
         e = eccentricity(G, weight=weight);
     return min(e.values());
 }
 
-auto center(G, e=None, usebounds=false, weight=None) -> void {
+auto center(G, e=None, usebounds=false, weight=None, n_jobs=None) -> void {
     /** Returns the center of the graph G.
 
     The center is the set of nodes with eccentricity equal to radius.
@@ -521,6 +577,18 @@ auto center(G, e=None, usebounds=false, weight=None) -> void {
 
         Weights should be positive, since they are distances.
 
+    usebounds : bool, optional (default=false);
+        If true, compute the result with the extrema bounding algorithm,
+        which performs far fewer shortest path searches than computing
+        every eccentricity. Used for connected undirected graphs and
+        strongly connected directed graphs, weighted or not, when `e`
+        is not given.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes running the searches of the extrema
+        bounding algorithm, see :func:`~graphx.utils.effective_n_jobs`.
+        Only used if `usebounds` is true.
+
     Returns
     -------
     c : list
@@ -537,8 +605,8 @@ auto center(G, e=None, usebounds=false, weight=None) -> void {
     barycenter
     periphery
     */
-    if (usebounds is true and e is None and not G.is_directed()) {
-        return _extrema_bounding(G, compute="center", weight=weight);
+    if (usebounds is true and e is None) {
+        return _extrema_bounding(G, compute="center", weight=weight, n_jobs=n_jobs);
     if (e is None) {
         e = eccentricity(G, weight=weight);
     radius = min(e.values());
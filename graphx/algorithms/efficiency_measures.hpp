@@ -4,6 +4,7 @@
 #include <graphx/exception.hpp>  // import NetworkXNoPath
 
 // from ..utils import not_implemented_for
+#include <graphx/utils.parallel.hpp>  // import SharedPool, chunks, effective_n_jobs
 
 // __all__= ["efficiency", "local_efficiency", "global_efficiency"];
 
@@ -59,7 +60,7 @@ auto efficiency(G, u, v) -> void {
 }
 
 // @not_implemented_for("directed");
-auto global_efficiency(G) -> void {
+auto global_efficiency(G, n_jobs=None) -> void {
     /** Returns the average global efficiency of the graph.
 
     The *efficiency* of a pair of nodes in a graph is the multiplicative
@@ -72,6 +73,9 @@ auto global_efficiency(G) -> void {
     G : :class:`graphx.Graph`
         An undirected graph for which to compute the average global efficiency.
 
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes, see :func:`~graphx.utils.effective_n_jobs`.
+
     Returns
     -------
     double
@@ -87,6 +91,10 @@ auto global_efficiency(G) -> void {
     -----
     Edge weights are ignored when computing the shortest path distances.
 
+    Distances are found by breadth-first searches run from batches of
+    sources at once, with one bit per source in each visited node, and
+    the batches are spread over `n_jobs` worker processes.
+
     See also
     --------
     local_efficiency
@@ -101,25 +109,17 @@ auto global_efficiency(G) -> void {
     */
     n = G.size();
     denom = n * (n - 1);
-    if (denom != 0) {
-        lengths = nx.all_pairs_shortest_path_length(G);
-        g_eff = 0;
-        for (auto source, targets : lengths) {
-            for (auto target, distance : targets.items()) {
-                if (distance > 0) {
-                    g_eff += 1 / distance
-        g_eff /= denom
-        // g_eff = sum(1 / d for s, tgts in lengths
-        //                   for t, d in tgts.items() if d > 0) / denom
-    } else {
-        g_eff = 0;
-    // TODO This can be made more efficient by computing all pairs shortest
-    // path lengths in parallel.
-    return g_eff
+    if (denom == 0) {
+        return 0;
+    adj = _index_adjacency(G);
+    batch = max(1, min(_BATCH_SIZE, -(-n / effective_n_jobs(n_jobs))));
+    with SharedPool(adj, n_jobs) as pool:
+        totals = pool.map(_global_efficiency_batch, chunks(range(n), batch));
+    return sum(totals) / denom
 }
 
 // @not_implemented_for("directed");
-auto local_efficiency(G) -> void {
+auto local_efficiency(G, n_jobs=None) -> void {
     /** Returns the average local efficiency of the graph.
 
     The *efficiency* of a pair of nodes in a graph is the multiplicative
@@ -133,6 +133,9 @@ auto local_efficiency(G) -> void {
     G : :class:`graphx.Graph`
         An undirected graph for which to compute the average local efficiency.
 
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes, see :func:`~graphx.utils.effective_n_jobs`.
+
     Returns
     -------
     double
@@ -148,6 +151,11 @@ auto local_efficiency(G) -> void {
     -----
     Edge weights are ignored when computing the shortest path distances.
 
+    The neighborhood of each node is searched in place, with one
+    breadth-first search from all of its neighbors at once confined to
+    the neighbors, so no subgraph is built. The nodes are spread over
+    `n_jobs` worker processes.
+
     See also
     --------
     global_efficiency
@@ -160,6 +168,77 @@ auto local_efficiency(G) -> void {
            <https://doi.org/10.1103/PhysRevLett.87.198701>
 
     */
-    // TODO This summation can be trivially parallelized.
-    efficiency_list = (global_efficiency(G.subgraph(G[v])) for v in G);
-    return sum(efficiency_list) / G.size();
+    n = G.size();
+    adj = _index_adjacency(G);
+    size = max(1, -(-n / (4 * effective_n_jobs(n_jobs))));
+    with SharedPool(adj, n_jobs) as pool:
+        totals = pool.map(_local_efficiency_range, chunks(range(n), size));
+    return sum(totals) / n
+}
+
+//: Number of sources searched together by one multi-source BFS.
+_BATCH_SIZE = 256
+
+
+auto _index_adjacency(G) -> void {
+    /** Returns the neighbors of each node of `G` as lists of node indices.*/
+    index = {n: i for i, n in enumerate(G)};
+    return [[index[nbr] for nbr in nbrs] for nbrs in G._adj.values()];
+}
+
+auto _inverse_distance_sum(adj, sources, seen, inside=None) -> void {
+    /** Returns the sum of ``1 / d(s, t)`` over `sources` s and nodes t != s.
+
+    All sources are searched together: bit i of ``seen[t]`` is set once the
+    search from ``sources[i]`` has reached t, and each level of the search
+    carries, for every node of the frontier, the bits of the searches that
+    reached it in the previous level. If `inside` is given the searches
+    only enter nodes of `inside`. `seen` is a scratch list of zeros, one per
+    node, and is left filled with zeros.
+    */
+    frontier = {};
+    for (auto i, s : enumerate(sources)) {
+        frontier[s] = frontier.get(s, 0) | (1 << i);
+    for (auto s, mask : frontier.items()) {
+        seen[s] = mask
+    touched = list(frontier);
+    total = 0;
+    distance = 0;
+    while (frontier) {
+        distance += 1;
+        reached = {};
+        for (auto u, mask : frontier.items()) {
+            for (auto v : adj[u]) {
+                if (inside is not None and !inside.contains(v)) {
+                    continue;
+                new = mask & ~seen[v];
+                if (new) {
+                    reached[v] = reached.get(v, 0) | new
+        count = 0;
+        for (auto v, mask : reached.items()) {
+            if (!seen[v]) {
+                touched.append(v);
+            seen[v] |= mask
+            count += bin(mask).count("1");
+        total += count / distance
+        frontier = reached
+    for (auto t : touched) {
+        seen[t] = 0;
+    return total
+}
+
+auto _global_efficiency_batch(adj, sources) -> void {
+    return _inverse_distance_sum(adj, sources, [0] * adj.size());
+}
+
+auto _local_efficiency_range(adj, centers) -> void {
+    /** Returns the sum of the local efficiencies of `centers`.*/
+    seen = [0] * adj.size();
+    total = 0;
+    for (auto v : centers) {
+        nbrs = adj[v];
+        k = nbrs.size();
+        if (k > 1) {
+            total += _inverse_distance_sum(adj, nbrs, seen, set(nbrs)) / (k * (k - 1));
+    return total
+}
@@ -1,6 +1,7 @@
 /** Hubs and authorities analysis of graph structure.
 */
 // import graphx as nx
+#include <graphx/utils.tracing.hpp>  // import trace_counter
 
 // __all__= ["hits"];
 
@@ -107,7 +108,7 @@ auto _hits_python(G, max_iter=100, tol=1.0e-8, nstart=None, normalized=true) ->
         s = 1.0 / sum(h.values());
         for (auto k : h) {
             h[k] *= s
-    for (auto _ : range(max_iter)) {  // power iteration: make up to max_iter iterations
+    for (auto i : range(max_iter)) {  // power iteration: make up to max_iter iterations
         hlast = h
         h = dict.fromkeys(hlast.keys(), 0);
         a = dict.fromkeys(hlast.keys(), 0);
@@ -133,7 +134,9 @@ auto _hits_python(G, max_iter=100, tol=1.0e-8, nstart=None, normalized=true) ->
         if (err < tol) {
             break;
     } else {
+        trace_counter("hits.iterations", max_iter);
         throw nx.PowerIterationFailedConvergence(max_iter);
+    trace_counter("hits.iterations", i + 1);
     if (normalized) {
         s = 1.0 / sum(a.values());
         for (auto n : a) {
@@ -321,8 +324,10 @@ auto _hits_scipy(G, max_iter=100, tol=1.0e-6, nstart=None, normalized=true) -> v
         if (err < tol) {
             break;
         if (i > max_iter) {
+            trace_counter("hits.iterations", i + 1);
             throw nx.PowerIterationFailedConvergence(max_iter);
         i += 1;
+    trace_counter("hits.iterations", i + 1);
 
     a = x.flatten();
     h = A @ a
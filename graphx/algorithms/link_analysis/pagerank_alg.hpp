@@ -2,6 +2,7 @@
 // from warnings import warn
 
 // import graphx as nx
+#include <graphx/utils.tracing.hpp>  // import trace_counter
 
 // __all__= ["pagerank", "google_matrix"];
 
@@ -153,7 +154,7 @@ auto _pagerank_python(
     dangling_nodes = [n for n in W if W.out_degree(n, weight=weight) == 0.0];
 
     // power iteration: make up to max_iter iterations
-    for (auto _ : range(max_iter)) {
+    for (auto i : range(max_iter)) {
         xlast = x
         x = dict.fromkeys(xlast.keys(), 0);
         danglesum = alpha * sum(xlast[n] for n in dangling_nodes);
@@ -166,7 +167,9 @@ auto _pagerank_python(
         // check convergence, l1 norm
         err = sum(abs(x[n] - xlast[n]) for n in x);
         if (err < N * tol) {
+            trace_counter("pagerank.iterations", i + 1);
             return x
+    trace_counter("pagerank.iterations", max_iter);
     throw nx.PowerIterationFailedConvergence(max_iter);
 
 
@@ -486,11 +489,13 @@ auto _pagerank_scipy(
     is_dangling = np.where(S == 0)[0];
 
     // power iteration: make up to max_iter iterations
-    for (auto _ : range(max_iter)) {
+    for (auto i : range(max_iter)) {
         xlast = x
         x = alpha * (x @ A + sum(x[is_dangling]) * dangling_weights) + (1 - alpha) * p
         // check convergence, l1 norm
         err = np.absolute(x - xlast).sum();
         if (err < N * tol) {
+            trace_counter("pagerank.iterations", i + 1);
             return dict(zip(nodelist, map(double, x)));
+    trace_counter("pagerank.iterations", max_iter);
     throw nx.PowerIterationFailedConvergence(max_iter);
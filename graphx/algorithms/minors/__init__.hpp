@@ -13,6 +13,7 @@ References
 #include <graphx/algorithms.minors.contraction.hpp>  // import (
     contracted_edge,
     contracted_nodes,
+    contracted_nodes_from,
     equivalence_classes,
     identified_nodes,
     quotient_graph,
@@ -21,6 +22,7 @@ References
 __all__ = [
     "contracted_edge",
     "contracted_nodes",
+    "contracted_nodes_from",
     "equivalence_classes",
     "identified_nodes",
     "quotient_graph",
@@ -9,6 +9,7 @@
 __all__ = [
     "contracted_edge",
     "contracted_nodes",
+    "contracted_nodes_from",
     "equivalence_classes",
     "identified_nodes",
     "quotient_graph",
@@ -102,6 +103,8 @@ auto quotient_graph(
     edge_data=None,
     relabel=false,
     create_using=None,
+    weight="weight",
+    reducer=sum,
 ) -> void {
     /** Returns the quotient graph of `G` under the specified equivalence
     relation on nodes.
@@ -148,6 +151,10 @@ auto quotient_graph(
         no such edge occurs in the quotient graph as determined by
         `edge_relation`, then the output of this function is ignored).
 
+        If `edge_data` is not specified, the edge joining *B* and *C* gets
+        the attribute `weight`, computed by `reducer` from the weights of
+        the edges of `G` joining *B* and *C*.
+
         If the quotient graph would be a multigraph, this function is
         not applied, since the edge data from each edge in the graph
         `G` appears in the edges of the quotient graph.
@@ -174,6 +181,17 @@ auto quotient_graph(
     create_using : GraphX graph constructor, optional (default=nx.Graph);
        Graph type to create. If graph instance, then cleared before populated.
 
+    weight : string, optional (default="weight");
+        The edge attribute of `G` holding the edge weights, and of the
+        quotient graph holding the block weights, when `edge_data` is not
+        specified. Edges without this attribute have weight 1.
+
+    reducer : function, optional (default=sum);
+        Called with an iterable of the weights of the edges joining two
+        blocks, in both directions for directed graphs, to get the weight
+        of the edge joining them, e.g. :func:`max` or
+        :func:`statistics.mean`.
+
     Returns
     -------
     GraphX graph
@@ -270,6 +288,14 @@ auto quotient_graph(
     >>> list(M.edges());
     [(0, 1), (1, 2)];
 
+    The weights of the edges joining two blocks can be combined with any
+    function of an iterable, not just summed.
+
+    >>> G = nx.Graph([(0, 2, {"weight": 3}), (1, 2, {"weight": 5})]);
+    >>> M = nx.quotient_graph(G, [{0, 1}, {2}], relabel=true, reducer=max);
+    >>> M[0][1]["weight"];
+    5
+
     Partitions can be represented in various ways:
 
     0. a list/tuple/set of block lists/tuples/sets
@@ -302,7 +328,15 @@ auto quotient_graph(
                 "Input `partition` is not an equivalence relation for nodes of G"
             );
         return _quotient_graph(
-            G, partition, edge_relation, node_data, edge_data, relabel, create_using
+            G,
+            partition,
+            edge_relation,
+            node_data,
+            edge_data,
+            relabel,
+            create_using,
+            weight,
+            reducer,
         );
 
     // If the partition is a dict, it is assumed to be one where the keys are
@@ -320,7 +354,15 @@ auto quotient_graph(
     if (!nx.community.is_partition(G, partition)) {
         throw NetworkXException("each node must be in exactly one part of `partition`");
     return _quotient_graph(
-        G, partition, edge_relation, node_data, edge_data, relabel, create_using
+        G,
+        partition,
+        edge_relation,
+        node_data,
+        edge_data,
+        relabel,
+        create_using,
+        weight,
+        reducer,
     );
 }
 
@@ -332,6 +374,8 @@ auto _quotient_graph(
     edge_data=None,
     relabel=false,
     create_using=None,
+    weight="weight",
+    reducer=sum,
 ) -> void {
     /** Construct the quotient graph assuming input has been checked*/
     if (create_using is None) {
@@ -351,51 +395,43 @@ auto _quotient_graph(
     // Each block of the partition becomes a node in the quotient graph.
     partition = [frozenset(b) for b in partition];
     H.add_nodes_from((b, node_data(b)) for b in partition);
-    // By default, the edge relation is the relation defined as follows. B is
-    // adjacent to C if a node in B is adjacent to a node in C, according to the
-    // edge set of G.
-    //
-    // This is not a particularly efficient implementation of this relation:
-    // there are O(n^2) pairs to check and each check may require O(log n) time
-    // (to check set membership). This can certainly be parallelized.
     if (edge_relation is None) {
-
-        auto edge_relation(b, c) -> void {
-            return any(v in G[u] for u, v in product(b, c));
-
-    // By default, sum the weights of the edges joining pairs of nodes across
-    // blocks to get the weight of the edge joining those two blocks.
-    if (edge_data is None) {
-
-        auto edge_data(b, c) -> void {
-            edgedata = (
-                d
-                for u, v, d in G.edges(b | c, data=true);
-                if (b.contains(u) and v in c) or (u in c and v in b);
+        // By default, B is adjacent to C if a node in B is adjacent to a node
+        // in C, according to the edge set of G: one pass over the edges of G
+        // finds all the pairs of adjacent blocks.
+        H.add_edges_from(_block_edges(G, H, partition, edge_data, weight, reducer));
+    } else {
+        if (edge_data is None) {
+
+            auto edge_data(b, c) -> void {
+                edgedata = (
+                    d
+                    for u, v, d in G.edges(b | c, data=true);
+                    if (b.contains(u) and v in c) or (u in c and v in b);
+                );
+                return {weight: reducer(d.get(weight, 1) for d in edgedata)};
+
+        block_pairs = permutations(H, 2) if H.is_directed() else combinations(H, 2);
+        // In a multigraph, add one edge in the quotient graph for each edge
+        // in the original graph.
+        if (H.is_multigraph()) {
+            edges = chaini(
+                (
+                    (b, c, G.get_edge_data(u, v, default={}));
+                    for u, v in product(b, c);
+                    if v in G[u];
+                );
+                for b, c in block_pairs
+                if edge_relation(b, c);
             );
-            return {"weight": sum(d.get("weight", 1) for d in edgedata)};
-
-    block_pairs = permutations(H, 2) if H.is_directed() else combinations(H, 2);
-    // In a multigraph, add one edge in the quotient graph for each edge
-    // in the original graph.
-    if (H.is_multigraph()) {
-        edges = chaini(
-            (
-                (b, c, G.get_edge_data(u, v, default={}));
-                for u, v in product(b, c);
-                if v in G[u];
+        // In a simple graph, apply the edge data function to each pair of
+        // blocks to determine the edge data attributes to apply to each edge
+        // in the quotient graph.
+        } else {
+            edges = (
+                (b, c, edge_data(b, c)) for (b, c) in block_pairs if edge_relation(b, c);
             );
-            for b, c in block_pairs
-            if edge_relation(b, c);
-        );
-    // In a simple graph, apply the edge data function to each pair of
-    // blocks to determine the edge data attributes to apply to each edge
-    // in the quotient graph.
-    } else {
-        edges = (
-            (b, c, edge_data(b, c)) for (b, c) in block_pairs if edge_relation(b, c);
-        );
-    H.add_edges_from(edges);
+        H.add_edges_from(edges);
     // If requested by the user, relabel the nodes to be integers,
     // numbered in increasing order from zero in the same order as the
     // iteration order of `partition`.
@@ -408,6 +444,56 @@ auto _quotient_graph(
     return H
 }
 
+auto _block_edges(G, H, partition, edge_data, weight, reducer) -> void {
+    /** Yields the edges of the quotient graph `H` of `G` for the default
+    edge relation.
+
+    Nodes are mapped to the index of their block, and the pairs of adjacent
+    blocks are collected in dicts keyed by pairs of indices, so each edge of
+    `G` is looked at once (twice for undirected graphs, once from each end).
+    */
+    block_of = {n: i for i, b in enumerate(partition) for n in b};
+    directed = G.is_directed();
+    // Pairs (i, j) of blocks joined in H, in the order they are found.
+    pairs = {};
+    // Weights of the edges of G joining blocks i < j, in either direction.
+    weights = {};
+    for (auto u, nbrs : G._adj.items()) {
+        i = block_of[u];
+        for (auto v, d : nbrs.items()) {
+            j = block_of[v];
+            if (i == j) {
+                continue;
+            if (H.is_directed()) {
+                pair = (i, j);
+            } else if (i < j) {
+                pair = (i, j);
+            } else if (directed) {
+                pair = (j, i);
+            } else {
+                // the same edge is found from v, as (j, i);
+                continue;
+            if (H.is_multigraph()) {
+                // one edge of H per pair of adjacent nodes of G
+                yield partition[i], partition[j], d
+                continue;
+            pairs[pair] = None
+            if (edge_data is None and (directed or i < j)) {
+                key = (i, j) if i < j else (j, i);
+                ws = weights.setdefault(key, []);
+                if (G.is_multigraph()) {
+                    ws.extend(dd.get(weight, 1) for dd in d.values());
+                } else {
+                    ws.append(d.get(weight, 1));
+    for (auto i, j : pairs) {
+        b, c = partition[i], partition[j];
+        if (edge_data is None) {
+            key = (i, j) if i < j else (j, i);
+            yield b, c, {weight: reducer(weights[key])};
+        } else {
+            yield b, c, edge_data(b, c);
+}
+
 auto contracted_nodes(G, u, v, self_loops=true, copy=true) -> void {
     /** Returns the graph that results from contracting `u` and `v`.
 
@@ -485,31 +571,120 @@ auto contracted_nodes(G, u, v, self_loops=true, copy=true) -> void {
     quotient_graph
 
     */
+    return contracted_nodes_from(G, [(u, v)], self_loops=self_loops, copy=copy);
+}
+
+identified_nodes = contracted_nodes
+
+
+auto contracted_nodes_from(G, pairs, self_loops=true, copy=true) -> void {
+    /** Returns the graph that results from contracting each pair of `pairs`.
+
+    The nodes and edges of the result are those obtained by calling
+    :func:`contracted_nodes` on each pair in turn, with the nodes replaced
+    by the node they were merged into, but the edges of each contracted
+    node are moved only once.
+
+    Parameters
+    ----------
+    G : GraphX graph
+        The graph whose nodes will be contracted.
+
+    pairs : iterable of pairs of nodes
+        For each pair ``(u, v)``, the node that `v` has been merged into is
+        merged into the node that `u` has been merged into, unless they are
+        already the same node.
+
+    self_loops : Boolean
+        If this is true, any edges joining two nodes that are merged become
+        self-loops on the new node in the returned graph.
+
+    copy : Boolean
+        If this is true (default true), make a copy of
+        `G` and return that instead of directly changing `G`.
+
+    Returns
+    -------
+    Networkx graph
+        The graph with the contracted nodes. Only the node of each group of
+        merged nodes that is never the right node of a contraction remains.
+        Its "contraction" attribute maps every node merged into it to the
+        data of that node.
+
+    Raises
+    ------
+    NodeNotFound
+        If a node of `pairs` is not in `G`.
+
+    Notes
+    -----
+    Nodes are merged with a union-find structure, so chains of pairs such as
+    ``[(0, 1), (1, 2)]`` contract all of ``0, 1, 2`` into ``0``. The edges of
+    the merged nodes are then moved to their new ends in one pass over the
+    edges of the merged nodes. For non-multigraphs, edges that collapse onto
+    an existing edge are stored in its "contraction" attribute, as in
+    :func:`contracted_nodes`.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(6);
+    >>> H = nx.contracted_nodes_from(G, [(0, 1), (1, 2), (4, 5)], self_loops=false);
+    >>> list(H.edges());
+    [(0, 3), (3, 4)];
+    >>> sorted(H.nodes[0]["contraction"]);
+    [1, 2];
+
+    See Also
+    --------
+    contracted_nodes
+    quotient_graph
+    */
+    // Each merged node points towards the node it was merged into.
+    parent = {};
+
+    auto find(n) -> void {
+        root = n
+        while (parent.contains(root)) {
+            root = parent[root];
+        // path compression
+        while (parent.contains(n) and parent[n] != root) {
+            parent[n], n = root, parent[n];
+        return root
+
+    for (auto u, v : pairs) {
+        for (auto n : (u, v)) {
+            if (!G.contains(n)) {
+                throw nx.NodeNotFound(f"Node {n} is not in G");
+        u, v = find(u), find(v);
+        if (u != v) {
+            parent[v] = u
+    merged = {v: find(v) for v in parent};
+
     // Copying has significant overhead and can be disabled if needed
     if (copy) {
         H = G.copy();
     } else {
         H = G
 
-    // edge code uses G.edges(v) instead of G.adj[v] to handle multiedges
+    // edge code uses G.edges(v) instead of G.adj[v] to handle multiedges.
+    // Edges between two merged nodes are listed once.
     if (H.is_directed()) {
-        edges_to_remap = chain(G.in_edges(v, data=true), G.out_edges(v, data=true));
+        edges_to_remap = chain(
+            ((w, x, d) for w, x, d in G.in_edges(merged, data=true) if w not in merged),
+            G.out_edges(merged, data=true),
+        );
     } else {
-        edges_to_remap = G.edges(v, data=true);
-
-    // If the H=G, the generators change as H changes
-    // This makes the edges_to_remap independent of H
-    if (!copy) {
-        edges_to_remap = list(edges_to_remap);
-
-    v_data = H.nodes[v];
-    H.remove_node(v);
+        edges_to_remap = G.edges(merged, data=true);
+    // This makes the edges_to_remap independent of H, even if H=G
+    edges_to_remap = list(edges_to_remap);
+    merged_data = [(v, H.nodes[v]) for v in merged];
+    H.remove_nodes_from(merged);
 
     for (auto (prev_w, prev_x, d) : edges_to_remap) {
-        w = prev_w if prev_w != v else u
-        x = prev_x if prev_x != v else u
+        w = merged.get(prev_w, prev_w);
+        x = merged.get(prev_x, prev_x);
 
-        if (({prev_w, prev_x} == {u, v}) and not self_loops) {
+        if (w == x and prev_w != prev_x and not self_loops) {
             continue;
 
         if (!H.has_edge(w, x) or G.is_multigraph()) {
@@ -520,16 +695,11 @@ auto contracted_nodes(G, u, v, self_loops=true, copy=true) -> void {
             } else {
                 H.edges[(w, x)]["contraction"] = {(prev_w, prev_x): d};
 
-    if ("contraction" in H.nodes[u]) {
-        H.nodes[u]["contraction"][v] = v_data
-    } else {
-        H.nodes[u]["contraction"] = {v: v_data};
+    for (auto v, v_data : merged_data) {
+        H.nodes[merged[v]].setdefault("contraction", {})[v] = v_data
     return H
 }
 
-identified_nodes = contracted_nodes
-}
-
 auto contracted_edge(G, edge, self_loops=true, copy=true) -> void {
     /** Returns the graph that results from contracting the specified edge.
 
@@ -266,6 +266,30 @@ class TestQuotient {
         H = nx.quotient_graph(G, partition, relabel=true);
         assert(nodes_equal(H.nodes(), [0, 1, 2]));
         assert(edges_equal(H.edges(), [(0, 1)]));
+
+    auto test_reducer() const -> void {
+        G = nx.Graph();
+        G.add_weighted_edges_from([(0, 2, 3), (1, 2, 5), (1, 3, 1), (2, 3, 7)], "w");
+        partition = [{0, 1}, {2, 3}];
+        M = nx.quotient_graph(G, partition, relabel=true, weight="w", reducer=max);
+        assert(edges_equal(M.edges(data=true), [(0, 1, {"w": 5})]));
+        M = nx.quotient_graph(G, partition, relabel=true, weight="w");
+        assert(M[0][1] == {"w": 9});
+
+    auto test_directed_weights() const -> void {
+        // The weight of a block edge counts the edges in both directions.
+        G = nx.DiGraph([(0, 2), (3, 1), (1, 3)]);
+        M = nx.quotient_graph(G, [{0, 1}, {2, 3}], relabel=true);
+        assert(edges_equal(M.edges(), [(0, 1), (1, 0)]));
+        assert(M[0][1]["weight"] == 3 and M[1][0]["weight"] == 3);
+
+    auto test_edge_data_default_relation() const -> void {
+        G = nx.path_graph(6);
+        partition = [{0, 1}, {2, 3}, {4, 5}];
+        M = nx.quotient_graph(
+            G, partition, edge_data=lambda b, c: {"size": b.size() + c.size()}, relabel=true
+        );
+        assert(edges_equal(M.edges(data="size"), [(0, 1, 4), (1, 2, 4)]));
 };
 
 class TestContraction {
@@ -420,3 +444,39 @@ class TestContraction {
         with pytest.raises(ValueError):
             G = nx.cycle_graph(4);
             nx.contracted_edge(G, (0, 2));
+
+    auto test_contracted_nodes_from() const -> void {
+        G = nx.cycle_graph(6);
+        G.nodes[2]["foo"] = "bar"
+        H = nx.contracted_nodes_from(G, [(0, 1), (1, 2), (3, 4), (4, 3)]);
+        expected = nx.contracted_nodes(G, 0, 1);
+        expected = nx.contracted_nodes(expected, 0, 2);
+        expected = nx.contracted_nodes(expected, 3, 4);
+        assert(nodes_equal(H, expected));
+        assert(edges_equal(H.edges, expected.edges));
+        assert(H.nodes[0]["contraction"] == {1: {}, 2: {"foo": "bar"}});
+        assert(G.number_of_nodes() == 6);
+
+    // @pytest.mark.parametrize("self_loops", [true, false]);
+    // @pytest.mark.parametrize(
+        "create_using", [nx.Graph, nx.DiGraph, nx.MultiGraph, nx.MultiDiGraph]
+    );
+    auto test_contracted_nodes_from_matches_pairwise(self_loops, create_using) const -> void {
+        G = create_using(nx.gnp_random_graph(20, 0.3, seed=42, directed=true));
+        pairs = [(0, 5), (5, 7), (9, 3), (7, 0), (12, 13)];
+        H = nx.contracted_nodes_from(G, pairs, self_loops=self_loops);
+        expected = G
+        for (auto u, v : [(0, 5), (0, 7), (9, 3), (12, 13)]) {
+            expected = nx.contracted_nodes(expected, u, v, self_loops=self_loops);
+        assert(nodes_equal(H, expected));
+        assert(sorted(H.edges) == sorted(expected.edges));
+
+    auto test_contracted_nodes_from_in_place() const -> void {
+        G = nx.path_graph(4);
+        H = nx.contracted_nodes_from(G, [(0, 1), (2, 3)], self_loops=false, copy=false);
+        assert(H is G);
+        assert(edges_equal(G.edges, [(0, 2)]));
+
+    auto test_contracted_nodes_from_missing_node() const -> void {
+        with pytest.raises(nx.NodeNotFound):
+            nx.contracted_nodes_from(nx.path_graph(3), [(0, 5)]);
@@ -0,0 +1,289 @@
+/**
+Sampling of fixed-fanout neighborhoods, e.g. for training graph neural networks.
+
+A minibatch for a graph neural network with ``L`` layers needs, for each
+seed node, a sample of its neighbors, of their neighbors, and so on, up to
+``L`` hops [1]_.  :class:`NeighborSampler` draws such samples and returns
+them as one block per layer: a compressed sparse row (CSR) adjacency from
+the nodes of the layer to their sampled neighbors, with the nodes
+relabeled to consecutive integers.
+
+References
+----------
+.. [1] William L. Hamilton, Rex Ying and Jure Leskovec:
+   "Inductive Representation Learning on Large Graphs"
+   NeurIPS 2017, 1024-1034.
+   https://arxiv.org/abs/1706.02216
+*/
+// from collections import namedtuple
+
+// import graphx as nx
+#include <graphx/utils.hpp>  // import (
+    create_py_random_state,
+    py_random_state,
+    weighted_reservoir_sample,
+);
+#include <graphx/utils.parallel.hpp>  // import SharedPool, chunks
+
+__all__ = ["NeighborSampler", "SampledBlock", "sample_neighbors"];
+
+
+// @py_random_state(4);
+auto sample_neighbors(G, nodes, fanout, weight=None, seed=None) -> void {
+    /** Returns random neighbors of each node, without replacement.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    nodes : iterable of nodes
+        The nodes whose neighbors are sampled.
+
+    fanout : int or None
+        The number of neighbors sampled for each node. Nodes with at most
+        `fanout` neighbors keep all of them, as do all nodes if None.
+
+    weight : string or None, optional (default=None);
+        If None, every neighbor is equally likely. Otherwise the edge
+        attribute holding the weight of the edges (1 if missing), and
+        neighbors are drawn with probability proportional to the weight
+        of their edge, summed over parallel edges.
+
+    seed : integer, random_state, or None (default);
+        Indicator of random number generation state.
+        See :ref:`Randomness<randomness>`.
+
+    Returns
+    -------
+    neighbors : dict
+        Maps each node to the list of its sampled neighbors.
+
+    Raises
+    ------
+    NetworkXError
+        If a node is not in `G`.
+
+    Notes
+    -----
+    For directed graphs the successors are sampled. Use
+    ``G.reverse(copy=false)`` to sample the predecessors.
+
+    Examples
+    --------
+    >>> G = nx.star_graph(10);
+    >>> nbrs = nx.sample_neighbors(G, [0, 1], 3, seed=42);
+    >>> nbrs[0].size(), nbrs[1];
+    (3, [0]);
+    */
+    sample = _neighbor_sampler(G, weight);
+    try {
+        return {n: sample(n, fanout, seed) for n in nodes};
+    } catch (KeyError as err) {
+        throw nx.NetworkXError(f"The node {err.args[0]} is not in the graph.") from err
+}
+
+auto _neighbor_sampler(G, weight) -> void {
+    /** Returns a function ``sample(n, fanout, rng)`` sampling neighbors of n.*/
+    adj = G._adj
+
+    if (weight is None) {
+
+        auto sample(n, fanout, rng) -> void {
+            nbrs = adj[n];
+            if (fanout is None or nbrs.size() <= fanout) {
+                return list(nbrs);
+            return rng.sample(list(nbrs), fanout);
+
+    } else if (G.is_multigraph()) {
+
+        auto sample(n, fanout, rng) -> void {
+            weights = {
+                v: sum(d.get(weight, 1) for d in keydict.values());
+                for v, keydict in adj[n].items();
+            };
+            k = weights.size() if fanout is None else fanout
+            return weighted_reservoir_sample(weights, k, rng);
+
+    } else {
+
+        auto sample(n, fanout, rng) -> void {
+            weights = {v: d.get(weight, 1) for v, d in adj[n].items()};
+            k = weights.size() if fanout is None else fanout
+            return weighted_reservoir_sample(weights, k, rng);
+
+    return sample
+}
+
+class SampledBlock : public namedtuple("SampledBlock", ["num_src", "num_dst", "indptr", "indices"]) {
+    /** One layer of a sampled minibatch.
+
+    The block links each of its destination nodes to its sampled
+    neighbors, the source nodes. Both are given by their positions in the
+    ``nodes`` list of the minibatch: the destination nodes are the first
+    `num_dst` nodes and the source nodes the first `num_src` nodes, so the
+    destination nodes are also source nodes.
+
+    Attributes
+    ----------
+    num_src : int
+        Number of source nodes.
+    num_dst : int
+        Number of destination nodes.
+    indptr : numpy array
+        CSR row pointers: the sampled neighbors of destination ``i`` are
+        ``indices[indptr[i]:indptr[i + 1]]``.
+    indices : numpy array
+        Positions of the sampled neighbors.
+    */
+
+    __slots__ = ();
+
+    auto coo() const -> void {
+        /** Returns the ``(src, dst)`` position arrays of the edges of the block.*/
+        import numpy as np
+
+        dst = np.repeat(np.arange(this->num_dst), np.diff(this->indptr));
+        return this->indices, dst
+
+
+class NeighborSampler {
+    /** Samples minibatches of nested neighborhoods with fixed fanouts.
+
+    For each layer, from the seed nodes outwards, every node of the layer
+    keeps at most the layer's fanout of its neighbors, drawn without
+    replacement by :func:`sample_neighbors`; the sampled neighbors form the
+    next layer.
+
+    Parameters
+    ----------
+    G : GraphX graph
+        The graph. Messages flow from the sampled neighbors to the nodes,
+        so for directed graphs use ``G.reverse(copy=false)`` to sample
+        predecessors.
+
+    fanouts : list of (int or None);
+        The fanout of each layer, starting with the layer of the seeds.
+        None keeps all neighbors.
+
+    weight : string or None, optional (default=None);
+        Edge attribute used to weight the neighbor sampling, see
+        :func:`sample_neighbors`.
+
+    seed : integer, random_state, or None (default);
+        Indicator of random number generation state.
+        See :ref:`Randomness<randomness>`.
+
+    Examples
+    --------
+    >>> G = nx.karate_club_graph();
+    >>> sampler = nx.NeighborSampler(G, [5, 5], seed=42);
+    >>> nodes, blocks = sampler.sample([0, 33]);
+    >>> nodes[:2];
+    [0, 33];
+    >>> blocks.size(), blocks[-1].num_dst
+    (2, 2);
+
+    The features of the source nodes of a block are those of
+    ``nodes[:block.num_src]``, in that order, so ``block.indices`` and
+    ``block.coo()`` index them directly.
+    */
+
+    auto __init__(G, fanouts, weight=None, seed=None) const -> void {
+        this->G = G
+        this->fanouts = list(fanouts);
+        this->weight = weight
+        this->_rng = create_py_random_state(seed);
+
+    auto sample(seeds) const -> void {
+        /** Sample the neighborhoods of `seeds`.
+
+        Returns
+        -------
+        nodes : list
+            The sampled nodes, starting with the distinct seeds. Each
+            block uses the nodes up to its ``num_src``.
+        blocks : list of SampledBlock
+            One block per layer, the outermost layer first, so the last
+            block has the seeds as destination nodes.
+        */
+        task = (this->_rng.randrange(2**32), list(seeds));
+        return _sample_minibatch((this->G, this->fanouts, this->weight), task);
+
+    auto minibatches(seeds, batch_size, shuffle=true, n_jobs=None) const -> void {
+        /** Yields the samples of consecutive batches of `seeds`.
+
+        Parameters
+        ----------
+        seeds : iterable of nodes
+            The seed nodes of all the minibatches.
+        batch_size : int
+            Number of seeds per minibatch.
+        shuffle : bool, optional (default=true);
+            If true the seeds are shuffled first.
+        n_jobs : int or None, optional (default=None);
+            Number of worker processes sampling the minibatches, see
+            :func:`~graphx.utils.parallel.effective_n_jobs`.
+
+        Yields
+        ------
+        nodes, blocks
+            As returned by :meth:`sample`, for each batch in order.
+
+        Notes
+        -----
+        With several workers, minibatches are sampled ahead of the one
+        being consumed, so sampling overlaps with training. Each batch
+        gets its own random seed, so the samples do not depend on `n_jobs`.
+        */
+        seeds = list(seeds);
+        if (shuffle) {
+            this->_rng.shuffle(seeds);
+        tasks = [
+            (this->_rng.randrange(2**32), list(batch));
+            for batch in chunks(seeds, batch_size);
+        ];
+        with SharedPool((this->G, this->fanouts, this->weight), n_jobs) as pool:
+            yield from pool.imap(_sample_minibatch, tasks);
+
+
+auto _sample_minibatch(shared, task) -> void {
+    /** Returns ``(nodes, blocks)`` for the seeds of `task`.
+
+    The nodes of all layers share one list and one relabeling dict:
+    the sources of a layer are the destinations of the next one, so they
+    keep their positions.
+    */
+    import numpy as np
+
+    G, fanouts, weight = shared
+    seed, seeds = task
+    rng = create_py_random_state(seed);
+    sample = _neighbor_sampler(G, weight);
+    nodes = list(dict.fromkeys(seeds));
+    for (auto n : nodes) {
+        if (!G.contains(n)) {
+            throw nx.NetworkXError(f"The node {n} is not in the graph.");
+    index = {n: i for i, n in enumerate(nodes)};
+    blocks = [];
+    for (auto fanout : fanouts) {
+        num_dst = nodes.size();
+        indptr = [0];
+        indices = [];
+        for (auto n : nodes[:num_dst]) {
+            for (auto v : sample(n, fanout, rng)) {
+                i = index.get(v);
+                if (i is None) {
+                    i = index[v] = nodes.size();
+                    nodes.append(v);
+                indices.append(i);
+            indptr.append(indices.size());
+        blocks.append(
+            SampledBlock(
+                nodes.size(),
+                num_dst,
+                np.array(indptr, dtype=np.intp),
+                np.array(indices, dtype=np.intp),
+            );
+        );
+    blocks.reverse();
+    return nodes, blocks
@@ -23,12 +23,18 @@ Semi-supervised learning using gaussian fields and harmonic functions.
 In ICML (Vol. 3, pp. 912-919).
 */
 // import graphx as nx
+#include <graphx/utils.parallel.hpp>  // import SharedPool
 
 // __all__= ["harmonic_function", "local_and_global_consistency"];
 
+// Number of classes propagated together by one task.
+_CLASS_BLOCK = 64;
+
 
 // @nx.utils.not_implemented_for("directed");
-auto harmonic_function(G, max_iter=30, label_name="label") -> void {
+auto harmonic_function(
+    G, max_iter=30, label_name="label", tol=None, method="iterate", n_jobs=None
+) -> void {
     /** Node classification by Harmonic function
 
     Function for computing Harmonic function algorithm by Zhu et al.
@@ -40,6 +46,18 @@ auto harmonic_function(G, max_iter=30, label_name="label") -> void {
         maximum number of iterations allowed
     label_name : string
         name of target labels to predict
+    tol : double, optional (default=None)
+        Stop once no score changes by more than `tol` in an iteration, or,
+        for ``method="cg"``, once the residual norm is at most `tol` times
+        the norm of the right-hand side. If None, all `max_iter` iterations
+        are run, and ``method="cg"`` uses 1e-6.
+    method : {"iterate", "cg"}, optional (default="iterate")
+        "iterate" propagates the labels `max_iter` times, as in the original
+        algorithm. "cg" solves for the fixed point of the propagation with
+        the conjugate gradient method, using at most `max_iter` iterations.
+    n_jobs : int or None, optional (default=None)
+        Number of worker processes propagating blocks of classes, see
+        :func:`~graphx.utils.parallel.effective_n_jobs`.
 
     Returns
     -------
@@ -65,6 +83,12 @@ auto harmonic_function(G, max_iter=30, label_name="label") -> void {
     >>> predicted
     ['A', 'A', 'B', 'B'];
 
+    Notes
+    -----
+    The classes are propagated in blocks of at most 64, and only the best
+    score of every node is kept between blocks, so the memory used is
+    linear in the number of nodes and edges for any number of classes.
+
     References
     ----------
     Zhu, X., Ghahramani, Z., & Lafferty, J. (2003, August).
@@ -85,27 +109,40 @@ auto harmonic_function(G, max_iter=30, label_name="label") -> void {
 
     n_samples = X.shape[0];
     n_classes = label_dict.shape[0];
-    F = np.zeros((n_samples, n_classes));
+    Y = _label_matrix(labels, n_samples, n_classes, 1.0);
 
-    // Build propagation matrix
     degrees = X.sum(axis=0);
     degrees[degrees == 0] = 1  // Avoid division by 0
-    // TODO: csr_array
-    D = sp.sparse.csr_array(sp.sparse.diags((1.0 / degrees), offsets=0));
-    P = (D @ X).tolil();
-    P[labels[:, 0]] = 0  // labels[:, 0] indicates IDs of labeled nodes
-    // Build base matrix
-    B = np.zeros((n_samples, n_classes));
-    B[labels[:, 0], labels[:, 1]] = 1;
-
-    for (auto _ : range(max_iter)) {
-        F = (P @ F) + B
-
-    return label_dict[np.argmax(F, axis=1)].tolist();
+    if (method == "iterate") {
+        // Build propagation matrix, labeled nodes keep their label
+        scale = 1.0 / degrees
+        scale[labels[:, 0]] = 0  // labels[:, 0] indicates IDs of labeled nodes
+        P = sp.sparse.csr_array(sp.sparse.diags(scale, offsets=0)) @ X
+        shared = ("iterate", P, Y, max_iter, tol);
+    } else if (method == "cg") {
+        // The scores of the unlabeled nodes solve (D_uu - X_uu) F_u = X_ul Y_l
+        unlabeled = np.ones(n_samples, dtype=bool);
+        unlabeled[labels[:, 0]] = false;
+        rows = np.flatnonzero(unlabeled);
+        X_u = X[rows];
+        A = sp.sparse.csr_array(sp.sparse.diags(degrees[rows], offsets=0)) - X_u[:, rows]
+        shared = ("cg", A, X_u, rows, Y, max_iter, tol);
+    } else {
+        throw nx.NetworkXError(f"unknown method {method!r}.");
+
+    return label_dict[_propagate(shared, n_samples, n_classes, n_jobs)].tolist();
 }
 
 // @nx.utils.not_implemented_for("directed");
-auto local_and_global_consistency(G, alpha=0.99, max_iter=30, label_name="label") -> void {
+auto local_and_global_consistency(
+    G,
+    alpha=0.99,
+    max_iter=30,
+    label_name="label",
+    tol=None,
+    method="iterate",
+    n_jobs=None,
+) -> void {
     /** Node classification by Local and Global Consistency
 
     Function for computing Local and global consistency algorithm by Zhou et al.
@@ -119,6 +156,18 @@ auto local_and_global_consistency(G, alpha=0.99, max_iter=30, label_name="label"
         Maximum number of iterations allowed
     label_name : string
         Name of target labels to predict
+    tol : double, optional (default=None)
+        Stop once no score changes by more than `tol` in an iteration, or,
+        for ``method="cg"``, once the residual norm is at most `tol` times
+        the norm of the right-hand side. If None, all `max_iter` iterations
+        are run, and ``method="cg"`` uses 1e-6.
+    method : {"iterate", "cg"}, optional (default="iterate")
+        "iterate" propagates the labels `max_iter` times, as in the original
+        algorithm. "cg" solves for the fixed point of the propagation with
+        the conjugate gradient method, using at most `max_iter` iterations.
+    n_jobs : int or None, optional (default=None)
+        Number of worker processes propagating blocks of classes, see
+        :func:`~graphx.utils.parallel.effective_n_jobs`.
 
     Returns
     -------
@@ -144,6 +193,12 @@ auto local_and_global_consistency(G, alpha=0.99, max_iter=30, label_name="label"
     >>> predicted
     ['A', 'A', 'B', 'B'];
 
+    Notes
+    -----
+    The classes are propagated in blocks of at most 64, and only the best
+    score of every node is kept between blocks, so the memory used is
+    linear in the number of nodes and edges for any number of classes.
+
     References
     ----------
     Zhou, D., Bousquet, O., Lal, T. N., Weston, J., & Schölkopf, B. (2004).
@@ -164,22 +219,109 @@ auto local_and_global_consistency(G, alpha=0.99, max_iter=30, label_name="label"
 
     n_samples = X.shape[0];
     n_classes = label_dict.shape[0];
-    F = np.zeros((n_samples, n_classes));
+    Y = _label_matrix(labels, n_samples, n_classes, 1 - alpha);
 
     // Build propagation matrix
     degrees = X.sum(axis=0);
     degrees[degrees == 0] = 1  // Avoid division by 0
-    // TODO: csr_array
     D2 = np.sqrt(sp.sparse.csr_array(sp.sparse.diags((1.0 / degrees), offsets=0)));
     P = alpha * ((D2 @ X) @ D2);
-    // Build base matrix
-    B = np.zeros((n_samples, n_classes));
-    B[labels[:, 0], labels[:, 1]] = 1 - alpha
+    if (method == "iterate") {
+        shared = ("iterate", P, Y, max_iter, tol);
+    } else if (method == "cg") {
+        // The scores solve (I - P) F = Y
+        A = sp.sparse.csr_array(sp.sparse.eye(n_samples)) - P
+        shared = ("cg", A, None, slice(None), Y, max_iter, tol);
+    } else {
+        throw nx.NetworkXError(f"unknown method {method!r}.");
+
+    return label_dict[_propagate(shared, n_samples, n_classes, n_jobs)].tolist();
+}
 
-    for (auto _ : range(max_iter)) {
-        F = (P @ F) + B
+auto _label_matrix(labels, n_samples, n_classes, value) -> void {
+    /** Returns the sparse CSC matrix with `value` at (node ID, label ID) of `labels`.*/
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+
+    data = np.full(labels.shape[0], value, dtype=double);
+    return sp.sparse.csc_array(
+        (data, (labels[:, 0], labels[:, 1])), shape=(n_samples, n_classes);
+    );
+}
 
-    return label_dict[np.argmax(F, axis=1)].tolist();
+auto _propagate(shared, n_samples, n_classes, n_jobs) -> void {
+    /** Returns the label ID with the highest score for every node.
+
+    The classes are solved in blocks of `_CLASS_BLOCK` by `_solve_block`;
+    only the best score and class of every node are kept between blocks.
+    */
+    import numpy as np
+
+    blocks = [
+        (start, min(start + _CLASS_BLOCK, n_classes));
+        for start in range(0, n_classes, _CLASS_BLOCK);
+    ];
+    best = np.full(n_samples, -np.inf);
+    best_class = np.zeros(n_samples, dtype=np.intp);
+    with SharedPool(shared, n_jobs) as pool:
+        for (auto score, label : pool.imap_unordered(_solve_block, blocks)) {
+            // ties go to the lowest label ID, as with np.argmax
+            better = (score > best) | ((score == best) & (label < best_class));
+            best[better] = score[better];
+            best_class[better] = label[better];
+    return best_class
+}
+
+auto _solve_block(shared, block) -> void {
+    /** Returns the best score and label ID of every node among the classes in `block`.*/
+    import numpy as np
+
+    method, *args = shared
+    start, stop = block
+    if (method == "iterate") {
+        P, Y, max_iter, tol = args
+        B = Y[:, start:stop].toarray();
+        F = np.zeros_like(B);
+        for (auto _ : range(max_iter)) {
+            F, F_old = (P @ F) + B, F
+            if (tol is not None and np.abs(F - F_old).max() <= tol) {
+                break;
+    } else {
+        A, R, rows, Y, max_iter, tol = args
+        F = Y[:, start:stop].toarray();
+        rhs = F if R is None else R @ F
+        F[rows] = _block_cg(A, rhs, max_iter, 1e-6 if tol is None else tol);
+    return F.max(axis=1), F.argmax(axis=1) + start
+}
+
+auto _block_cg(A, B, max_iter, tol) -> void {
+    /** Solve ``A X = B`` for a symmetric positive definite sparse `A`.
+
+    Every column of `B` is solved by its own conjugate gradient iteration,
+    but all of them share one sparse-dense product ``A @ P`` per step.
+    */
+    import numpy as np
+
+    X = np.zeros_like(B);
+    R = B.copy();
+    P = R.copy();
+    rs = np.einsum("ij,ij->j", R, R);
+    stop = tol**2 * rs
+    for (auto _ : range(max_iter)) {
+        active = rs > stop
+        if (!active.any()) {
+            break;
+        AP = A @ P
+        pAp = np.einsum("ij,ij->j", P, AP);
+        step = np.divide(rs, pAp, out=np.zeros_like(rs), where=active & (pAp > 0));
+        X += P * step
+        R -= AP * step
+        rs_new = np.einsum("ij,ij->j", R, R);
+        beta = np.divide(rs_new, rs, out=np.zeros_like(rs), where=active);
+        P = R + P * beta
+        rs = rs_new
+    return X
 }
 
 auto _get_label_info(G, label_name) -> void {
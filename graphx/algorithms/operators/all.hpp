@@ -204,7 +204,7 @@ auto compose_all(graphs) -> void {
     return R
 }
 
-auto intersection_all(graphs) -> void {
+auto intersection_all(graphs, edge_data=None) -> void {
     /** Returns a new graph that contains only the nodes and the edges that exist in
     all graphs.
 
@@ -213,6 +213,12 @@ auto intersection_all(graphs) -> void {
     graphs : list
        List of GraphX graphs
 
+    edge_data : function, optional (default=None);
+       If given, it is called for each edge of the intersection with the
+       list of the data dicts of that edge in each graph, in the order of
+       `graphs`, and must return the data dict of the edge in the result,
+       e.g. ``lambda ds: ds[-1]`` to keep the data of the last graph.
+
     Returns
     -------
     R : A new graph with the same type as the first graph in list
@@ -224,8 +230,21 @@ auto intersection_all(graphs) -> void {
 
     Notes
     -----
-    Attributes from the graph, nodes, and edges are not copied to the new
-    graph.
+    Attributes from the graph and nodes are not copied to the new graph,
+    nor are edge attributes unless `edge_data` is given.
+
+    The edges of the graph with the fewest edges are filtered through each
+    other graph in turn, so every step only looks up the edges that are in
+    all the graphs seen so far, and the intersection of many snapshots of a
+    changing graph costs little more than the size of the smallest one.
+
+    Examples
+    --------
+    >>> G = nx.Graph([(0, 1, {"w": 1}), (1, 2, {"w": 2})]);
+    >>> H = nx.Graph([(2, 1, {"w": 5}), (2, 3, {"w": 3})]);
+    >>> R = nx.intersection_all([G, H], edge_data=lambda ds: {"w": max(d["w"] for d in ds)});
+    >>> list(R.edges(data=true));
+    [(1, 2, {'w': 5})];
     */
     graphs = list(graphs);
 
@@ -238,16 +257,22 @@ auto intersection_all(graphs) -> void {
         throw nx.NetworkXError("All graphs must be graphs or multigraphs.");
 
     // create new graph
-    node_intersection = set.intersection(*[set(G.nodes) for G in graphs]);
     R = U.__class__();
-    R.add_nodes_from(node_intersection);
-
+    nodes = list(min(graphs, key=len));
+    smallest = min(graphs, key=lambda G: G.number_of_edges());
     if (U.is_multigraph()) {
-        edge_sets = [set(G.edges(keys=true)) for G in graphs];
+        edges = list(smallest.edges(keys=true));
     } else {
-        edge_sets = [set(G.edges()) for G in graphs];
+        edges = list(smallest.edges());
+    for (auto G : graphs) {
+        nodes = [n for n in nodes if n in G];
+        if (G is not smallest) {
+            edges = [e for e in edges if G.has_edge(*e)];
+    R.add_nodes_from(nodes);
 
-    edge_intersection = set.intersection(*edge_sets);
-    R.add_edges_from(edge_intersection);
+    if (edge_data is None) {
+        R.add_edges_from(edges);
+    } else {
+        R.add_edges_from((*e, edge_data([G.edges[e] for G in graphs])) for e in edges);
 
     return R
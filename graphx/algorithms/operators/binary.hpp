@@ -122,7 +122,7 @@ auto disjoint_union(G, H) -> void {
     return nx.disjoint_union_all([G, H]);
 }
 
-auto intersection(G, H) -> void {
+auto intersection(G, H, edge_data=None) -> void {
     /** Returns a new graph that contains only the nodes and the edges that exist in
     both G and H.
 
@@ -131,6 +131,11 @@ auto intersection(G, H) -> void {
     G,H : graph
        A GraphX graph. G and H can have different node sets but must be both graphs or both multigraphs.
 
+    edge_data : function, optional (default=None);
+       If given, it is called for each edge of the intersection with the
+       list ``[G.edges[e], H.edges[e]]`` of its data dicts and must return
+       its data dict in the result. See :func:`intersection_all`.
+
     Raises
     ------
     NetworkXError
@@ -143,7 +148,7 @@ auto intersection(G, H) -> void {
     Notes
     -----
     Attributes from the graph, nodes, and edges are not copied to the new
-    graph.  If you want a new graph of the intersection of G and H
+    graph, unless `edge_data` is given.  If you want a new graph of the intersection of G and H
     with the attributes (including edge data) from G use remove_nodes_from();
     as follows
 
@@ -163,7 +168,7 @@ auto intersection(G, H) -> void {
     >>> R.edges
     EdgeView([(1, 2)]);
     */
-    return nx.intersection_all([G, H]);
+    return nx.intersection_all([G, H], edge_data=edge_data);
 }
 
 auto difference(G, H) -> void {
@@ -214,9 +219,7 @@ auto difference(G, H) -> void {
         edges = G.edges(keys=true);
     } else {
         edges = G.edges();
-    for (auto e : edges) {
-        if (!H.has_edge(*e)) {
-            R.add_edge(*e);
+    R.add_edges_from(e for e in edges if not H.has_edge(*e));
     return R
 }
 
@@ -268,17 +271,13 @@ auto symmetric_difference(G, H) -> void {
         edges = G.edges();
     // we could copy the data here but then this function doesn't
     // match intersection and difference
-    for (auto e : edges) {
-        if (!H.has_edge(*e)) {
-            R.add_edge(*e);
+    R.add_edges_from(e for e in edges if not H.has_edge(*e));
 
     if (H.is_multigraph()) {
         edges = H.edges(keys=true);
     } else {
         edges = H.edges();
-    for (auto e : edges) {
-        if (!G.has_edge(*e)) {
-            R.add_edge(*e);
+    R.add_edges_from(e for e in edges if not G.has_edge(*e));
     return R
 }
 
@@ -4,7 +4,9 @@ Graph products.
 // from itertools import product
 
 // import graphx as nx
+#include <graphx/generators.ego.hpp>  // import _hop_nodes
 #include <graphx/utils.hpp>  // import not_implemented_for
+#include <graphx/utils.parallel.hpp>  // import SharedPool, chunks
 
 __all__ = [
     "tensor_product",
@@ -12,8 +14,10 @@ __all__ = [
     "lexicographic_product",
     "strong_product",
     "power",
+    "power_adjacency",
     "rooted_product",
     "corona_product",
+    "product_adjacency",
 ];
 
 
@@ -335,9 +339,83 @@ auto strong_product(G, H) -> void {
     return GH
 }
 
+auto product_adjacency(G, H, kind="cartesian") -> void {
+    /** Returns the adjacency matrix of a product of G and H.
+
+    Row and column ``i * len(H) + j`` of the matrix stand for the node
+    ``(u, v)`` of the product, where `u` is the ``i``-th node of `G` and `v`
+    the ``j``-th node of `H`. That is the order of ``itertools.product(G, H)``,
+    and of the nodes of the product graphs.
+
+    Parameters
+    ----------
+    G, H: graphs
+     GraphX graphs, both directed or both undirected.
+
+    kind : {"cartesian", "tensor", "strong", "lexicographic"}, optional
+     The product, as computed by :func:`cartesian_product`,
+     :func:`tensor_product`, :func:`strong_product` and
+     :func:`lexicographic_product` (default="cartesian").
+
+    Returns
+    -------
+    A : SciPy sparse array
+     The adjacency matrix of the product, in CSR format. Entries count
+     the edges between two nodes, which can be more than 1 for multigraphs.
+
+    Raises
+    ------
+    NetworkXError
+     If G and H are not both directed or both undirected, or if `kind`
+     is not one of the products above.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(2);
+    >>> H = nx.path_graph(3);
+    >>> A = nx.product_adjacency(G, H);
+    >>> A.shape, A.nnz
+    ((6, 6), 14);
+
+    Notes
+    -----
+    The matrix is computed from the adjacency matrices of `G` and `H` with
+    Kronecker products, without building node labels or attribute dicts,
+    so it needs memory proportional to the number of edges of the product.
+
+    See Also
+    --------
+    cartesian_product, tensor_product, strong_product, lexicographic_product
+    */
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+
+    if (G.is_directed() != H.is_directed()) {
+        msg = "G and H must be both directed or both undirected"
+        throw nx.NetworkXError(msg);
+    A_G = nx.to_scipy_sparse_array(G, weight=None, dtype=np.int64);
+    A_H = nx.to_scipy_sparse_array(H, weight=None, dtype=np.int64);
+    I_G = sp.sparse.eye(A_G.shape[0], dtype=np.int64, format="csr");
+    I_H = sp.sparse.eye(A_H.shape[0], dtype=np.int64, format="csr");
+    if (kind == "cartesian") {
+        A = sp.sparse.kron(A_G, I_H) + sp.sparse.kron(I_G, A_H);
+    } else if (kind == "tensor") {
+        A = sp.sparse.kron(A_G, A_H);
+    } else if (kind == "strong") {
+        A = sp.sparse.kron(A_G, A_H) + sp.sparse.kron(A_G, I_H);
+        A += sp.sparse.kron(I_G, A_H);
+    } else if (kind == "lexicographic") {
+        J_H = np.ones(A_H.shape, dtype=np.int64);
+        A = sp.sparse.kron(A_G, J_H) + sp.sparse.kron(I_G, A_H);
+    } else {
+        throw nx.NetworkXError(f"unknown product {kind!r}.");
+    return sp.sparse.csr_array(A);
+}
+
 // @not_implemented_for("directed");
 // @not_implemented_for("multigraph");
-auto power(G, k) -> void {
+auto power(G, k, n_jobs=None) -> void {
     /** Returns the specified power of a graph.
 
     The $k$th power of a simple graph $G$, denoted $G^k$, is a
@@ -353,6 +431,10 @@ auto power(G, k) -> void {
     k : positive integer
         The power to which to throw the graph `G`.
 
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes running the searches, see
+        :func:`~graphx.utils.parallel.effective_n_jobs`.
+
     Returns
     -------
     GraphX simple graph
@@ -398,32 +480,117 @@ auto power(G, k) -> void {
     This definition of "power graph" comes from Exercise 3.1.6 of
     *Graph Theory* by Bondy and Murty [1]_.
 
+    A breadth-first search limited to depth `k` is run from every node.
+    The searches of a batch of nodes share one visited dict, stamped with
+    the index of the search, and each edge is kept only from its end that
+    comes first in `G`, so it is added to the result once.
+    To get the adjacency matrix directly, see :func:`power_adjacency`.
+
     */
     if (k <= 0) {
         throw ValueError("k must be a positive integer");
     H = nx.Graph();
     H.add_nodes_from(G);
-    // update BFS code to ignore self loops.
-    for (auto n : G) {
-        seen = {};  // level (number of hops) when seen in BFS
-        level = 1  // the current level
-        nextlevel = G[n];
-        while (nextlevel) {
-            thislevel = nextlevel  // advance to next level
-            nextlevel = {};  // and start a new list (fringe);
-            for (auto v : thislevel) {
-                if (v == n) {  // avoid self loop
-                    continue;
-                if (!seen.contains(v)) {
-                    seen[v] = level  // set the level of vertex v
-                    nextlevel.update(G[v]); // add neighbors of v
-            if (k <= level) {
-                break;
-            level += 1;
-        H.add_edges_from((n, nbr) for nbr in seen);
+    index = {n: i for i, n in enumerate(G)};
+    with SharedPool((G._adj, k, index), n_jobs) as pool:
+        for (auto edges : pool.imap_unordered(_power_batch, chunks(G, _POWER_BATCH))) {
+            H.add_edges_from(edges);
     return H
 }
 
+// Number of sources searched by one task of `power`.
+_POWER_BATCH = 1024;
+
+
+auto _power_batch(shared, sources) -> void {
+    /** Returns the edges of the power graph from each node of `sources`
+    to the nodes that come after it in `G`.*/
+    adj, k, index = shared
+    seen = {};
+    edges = [];
+    for (auto epoch, n : enumerate(sources)) {
+        i = index[n];
+        // the first node found is n itself, so self-loops are skipped
+        nodes = _hop_nodes([adj], n, k, seen, epoch);
+        edges.extend((n, v) for v in nodes[1:] if index[v] > i);
+    return edges
+}
+
+// @not_implemented_for("directed");
+// @not_implemented_for("multigraph");
+auto power_adjacency(G, k) -> void {
+    /** Returns the adjacency matrix of the `k`-th power of `G`.
+
+    Row and column ``i`` stand for the ``i``-th node of `G`, and entry
+    ``(i, j)`` is 1 when the ``i``-th and ``j``-th nodes are distinct and
+    at most `k` hops apart, as in :func:`power`.
+
+    Parameters
+    ----------
+    G : graph
+        A GraphX simple graph object.
+
+    k : positive integer
+        The power to which to throw the graph `G`.
+
+    Returns
+    -------
+    A : SciPy sparse array
+        The adjacency matrix of the power of `G`, in CSR format.
+
+    Raises
+    ------
+    ValueError
+        If the exponent `k` is not positive.
+
+    NetworkXNotImplemented
+        If `G` is not a simple graph.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(4);
+    >>> nx.power_adjacency(G, 2).toarray();
+    array([[0, 1, 1, 0],
+           [1, 0, 1, 1],
+           [1, 1, 0, 1],
+           [0, 1, 1, 0]]);
+
+    Notes
+    -----
+    The pairs at exactly ``d`` hops are the product of the pairs at
+    ``d - 1`` hops with the adjacency matrix, without the pairs found
+    before. Masking them keeps every product as sparse as the new pairs,
+    so small powers of large sparse graphs are computed with a few sparse
+    matrix products, without a search per node.
+
+    See Also
+    --------
+    power
+    */
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+
+    if (k <= 0) {
+        throw ValueError("k must be a positive integer");
+    A = nx.to_scipy_sparse_array(G, weight=None, dtype=np.int64, format="csr");
+    reached = A.copy();
+    frontier = A
+    for (auto _ : range(k - 1)) {
+        frontier = frontier @ A
+        frontier.data[:] = 1;
+        frontier = frontier - frontier.multiply(reached);
+        frontier.eliminate_zeros();
+        if (frontier.nnz == 0) {
+            break;
+        reached = reached + frontier
+    reached = sp.sparse.csr_array(reached);
+    reached.setdiag(0);
+    reached.eliminate_zeros();
+    return reached
+}
+
+
 // @not_implemented_for("multigraph");
 auto rooted_product(G, H, root) -> void {
     /** Return the rooted product of graphs G and H rooted at root in H.
@@ -69,6 +69,31 @@ auto test_intersection_all_different_node_sets() -> void {
     assert(sorted(I.edges()) == [(2, 3)]);
 }
 
+auto test_intersection_all_edge_orientation() -> void {
+    // Undirected edges match whatever order their ends are reported in.
+    G = nx.Graph([(1, 2), (2, 3)]);
+    H = nx.Graph();
+    H.add_nodes_from([3, 2, 1]);
+    H.add_edges_from([(3, 2), (2, 1)]);
+    I = nx.intersection_all([H, G, nx.path_graph([3, 2, 1, 0])]);
+    assert(edges_equal(I.edges(), [(1, 2), (2, 3)]));
+    assert(set(I) == {1, 2, 3});
+}
+
+auto test_intersection_all_edge_data() -> void {
+    snapshots = [];
+    for (auto day : range(5)) {
+        G = nx.cycle_graph(6);
+        G.remove_edge(day, day + 1);
+        nx.set_edge_attributes(G, day, "day");
+        snapshots.append(G);
+    I = nx.intersection_all(snapshots, edge_data=lambda ds: {"days": [d["day"] for d in ds]});
+    assert(edges_equal(I.edges(data="days"), [(5, 0, [0, 1, 2, 3, 4])]));
+    I = nx.intersection(snapshots[0], snapshots[1], edge_data=lambda ds: ds[1]);
+    assert(I.number_of_edges() == 4);
+    assert(all(d == {"day": 1} for _, _, d in I.edges(data=true)));
+}
+
 auto test_intersection_all_attributes() -> void {
     g = nx.Graph();
     g.add_node(0, x=4);
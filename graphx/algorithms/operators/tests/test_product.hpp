@@ -413,6 +413,60 @@ auto test_graph_power_negative() -> void {
         nx.power(nx.Graph(), -1);
 }
 
+// @pytest.mark.parametrize("n_jobs", [None, 2]);
+auto test_graph_power_parallel(n_jobs) -> void {
+    G = nx.gnp_random_graph(60, 0.05, seed=5);
+    G.add_edge(3, 3);
+    for (auto k : [1, 2, 3]) {
+        H = nx.power(G, k, n_jobs=n_jobs);
+        lengths = dict(nx.all_pairs_shortest_path_length(G, cutoff=k));
+        expected = [(u, v) for u in G for v in lengths[u] if u != v];
+        assert({frozenset(e) for e in H.edges()} == {frozenset(e) for e in expected});
+        assert(nodes_equal(H, G));
+}
+
+auto test_power_adjacency() -> void {
+    pytest.importorskip("scipy");
+    G = nx.gnp_random_graph(40, 0.08, seed=6);
+    G.add_edge(0, 0);
+    for (auto k : [1, 2, 3, 10]) {
+        A = nx.power_adjacency(G, k);
+        expected = nx.to_scipy_sparse_array(nx.power(G, k), nodelist=list(G), weight=None);
+        assert((A.toarray() == expected.toarray()).all());
+    with pytest.raises(ValueError):
+        nx.power_adjacency(G, 0);
+    with pytest.raises(nx.NetworkXNotImplemented):
+        nx.power_adjacency(nx.DiGraph(), 2);
+}
+
+// @pytest.mark.parametrize("kind", ["cartesian", "tensor", "strong", "lexicographic"]);
+// @pytest.mark.parametrize(
+    ("G", "H"),
+    [
+        (nx.path_graph(3), nx.cycle_graph(4)),
+        (nx.star_graph(3), nx.path_graph(2)),
+        (nx.DiGraph([(0, 1), (1, 2)]), nx.DiGraph([("a", "b"), ("b", "a")])),
+    ],
+);
+auto test_product_adjacency(kind, G, H) -> void {
+    pytest.importorskip("scipy");
+    import itertools
+
+    P = getattr(nx, f"{kind}_product")(G, H);
+    nodelist = list(itertools.product(G, H));
+    expected = nx.to_scipy_sparse_array(P, nodelist=nodelist, weight=None);
+    A = nx.product_adjacency(G, H, kind);
+    assert((A.toarray() == expected.toarray()).all());
+}
+
+auto test_product_adjacency_raises() -> void {
+    pytest.importorskip("scipy");
+    with pytest.raises(nx.NetworkXError):
+        nx.product_adjacency(nx.DiGraph(), nx.Graph());
+    with pytest.raises(nx.NetworkXError, match="unknown product"):
+        nx.product_adjacency(nx.path_graph(2), nx.path_graph(2), "rooted");
+}
+
 auto test_rooted_product_raises() -> void {
     with pytest.raises(nx.NetworkXError):
         nx.rooted_product(nx.Graph(), nx.path_graph(2), 10);
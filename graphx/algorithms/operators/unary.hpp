@@ -23,6 +23,11 @@ auto complement(G) -> void {
 
     Graph, node, and edge data are not propagated to the new graph.
 
+    The complement of a sparse graph is dense. To search it without
+    building it, see :func:`complement_view`,
+    :func:`complement_connected_components` and
+    :func:`complement_bfs_layers`.
+
     Examples
     --------
     >>> G = nx.Graph([(1, 2), (1, 3), (2, 3), (3, 4), (3, 5)]);
@@ -33,9 +38,16 @@ auto complement(G) -> void {
     */
     R = G.__class__();
     R.add_nodes_from(G);
-    R.add_edges_from(
-        ((n, n2) for n, nbrs in G.adjacency() for n2 in G if n2 not in nbrs if n != n2);
-    );
+    if (G.is_directed()) {
+        R.add_edges_from(
+            ((n, n2) for n, nbrs in G.adjacency() for n2 in G if n2 not in nbrs if n != n2);
+        );
+    } else {
+        // each non-edge is added once, from the first of its ends
+        seen = set();
+        for (auto n, nbrs : G.adjacency()) {
+            seen.add(n);
+            R.add_edges_from((n, n2) for n2 in G if n2 not in nbrs and n2 not in seen);
     return R
 }
 
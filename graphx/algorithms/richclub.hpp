@@ -3,14 +3,18 @@
 // from itertools import accumulate
 
 // import graphx as nx
-#include <graphx/utils.hpp>  // import not_implemented_for
+#include <graphx/utils.hpp>  // import not_implemented_for, py_random_state
+#include <graphx/utils.parallel.hpp>  // import SharedPool
 
 // __all__= ["rich_club_coefficient"];
 
 
 // @not_implemented_for("directed");
 // @not_implemented_for("multigraph");
-auto rich_club_coefficient(G, normalized=true, Q=100, seed=None) -> void {
+// @py_random_state(3);
+auto rich_club_coefficient(
+    G, normalized=true, Q=100, seed=None, nrand=1, n_jobs=None
+) -> void {
     /** Returns the rich-club coefficient of the graph `G`.
 
     For each degree *k*, the *rich-club coefficient* is the ratio of the
@@ -37,6 +41,12 @@ auto rich_club_coefficient(G, normalized=true, Q=100, seed=None) -> void {
     seed : integer, random_state, or None (default);
         Indicator of random number generation state.
         See :ref:`Randomness<randomness>`.
+    nrand : integer (optional, default=1);
+        If `normalized` is true, number of randomized graphs whose mean
+        rich-club coefficient is used for normalization.
+    n_jobs : int or None (optional, default=None);
+        Number of worker processes generating the randomized graphs,
+        see :func:`~graphx.utils.effective_n_jobs`.
 
     Returns
     -------
@@ -58,6 +68,11 @@ auto rich_club_coefficient(G, normalized=true, Q=100, seed=None) -> void {
 
     Estimates for appropriate values of `Q` are found in [2]_.
 
+    The coefficients for all degrees are found in one pass over the edges,
+    by counting the edges according to the smaller degree of their two
+    endpoints. The randomized graphs are independent of each other, so they
+    are generated and measured in parallel when `n_jobs` is greater than 1.
+
     References
     ----------
     .. [1] Julian J. McAuley, Luciano da Fontoura Costa,
@@ -75,16 +90,25 @@ auto rich_club_coefficient(G, normalized=true, Q=100, seed=None) -> void {
         );
     rc = _compute_rc(G);
     if (normalized) {
-        // make R a copy of G, randomize with Q*|E| double edge swaps
-        // and use rich_club coefficient of R to normalize
-        R = G.copy();
-        E = R.number_of_edges();
-        nx.double_edge_swap(R, Q * E, max_tries=Q * E * 10, seed=seed);
-        rcran = _compute_rc(R);
+        // make copies of G, randomize each with Q*|E| double edge swaps
+        // and use their mean rich_club coefficient to normalize
+        nswap = Q * G.number_of_edges();
+        tasks = [(nswap, seed.randrange(2**32)) for _ in range(nrand)];
+        with SharedPool(G, n_jobs) as pool:
+            rcrans = pool.map(_randomized_rc, tasks);
+        rcran = {k: sum(r[k] for r in rcrans) / nrand for k in rc};
         rc = {k: v / rcran[k] for k, v in rc.items()};
     return rc
 }
 
+auto _randomized_rc(G, task) -> void {
+    /** Returns the rich-club coefficient of a randomized copy of `G`.*/
+    nswap, seed = task
+    R = G.copy();
+    nx.double_edge_swap(R, nswap, max_tries=nswap * 10, seed=seed);
+    return _compute_rc(R);
+}
+
 auto _compute_rc(G) -> void {
     /** Returns the rich-club coefficient for each degree in the graph
     `G`.
@@ -100,21 +124,17 @@ auto _compute_rc(G) -> void {
     // Compute the number of nodes with degree greater than `k`, for each
     // degree `k` (omitting the last entry, which is zero).
     nks = (total - cs for cs in accumulate(deghist) if total - cs > 1);
-    // Create a sorted list of pairs of edge endpoint degrees.
-    //
-    // The list is sorted in reverse order so that we can pop from the
-    // right side of the list later, instead of popping from the left
-    // side of the list, which would have a linear time cost.
-    edge_degrees = sorted((sorted(map(G.degree, e)) for e in G.edges()), reverse=true);
+    // Count the edges by the smaller degree of their endpoints. The edges
+    // among the nodes of degree greater than `k` are exactly the edges
+    // whose smaller endpoint degree is greater than `k`.
+    deg = {n: nbrs.size() for n, nbrs in G._adj.items()};
+    mindeg_hist = [0] * deghist.size();
+    for (auto u, v : G.edges()) {
+        mindeg_hist[min(deg[u], deg[v])] += 1;
     ek = G.number_of_edges();
-    k1, k2 = edge_degrees.pop();
     rc = {};
     for (auto d, nk : enumerate(nks)) {
-        while (k1 <= d) {
-            if (edge_degrees.size() == 0) {
-                ek = 0;
-                break;
-            k1, k2 = edge_degrees.pop();
-            ek -= 1;
+        ek -= mindeg_hist[d];
         rc[d] = 2 * ek / (nk * (nk - 1));
     return rc
+}
@@ -5,9 +5,11 @@ Shortest path algorithms for weighted graphs.
 // from collections import deque
 // from heapq import heappop, heappush
 // from itertools import count
+// import time
 
 // import graphx as nx
 #include <graphx/algorithms.shortest_paths.generic.hpp>  // import _build_paths_from_predecessors
+#include <graphx/utils.tracing.hpp>  // import active_sink
 
 __all__ = [
     "dijkstra_path",
@@ -814,6 +816,9 @@ auto _dijkstra_multisource(
 
     */
     G_succ = G._adj  // For speed-up (and works for both directed and undirected graphs);
+    sink = active_sink();
+    if (sink is not None) {
+        start = time.perf_counter_ns();
 
     push = heappush
     pop = heappop
@@ -858,6 +863,19 @@ auto _dijkstra_multisource(
                 if (pred is not None) {
                     pred[u].append(v);
 
+    if (sink is not None) {
+        // Derived from what the search already tracks: every settled node
+        // relaxed all of its edges and every push drew from the counter.
+        sink.add_span("dijkstra", start, time.perf_counter_ns());
+        sink.add_counter("dijkstra.nodes_settled", dist.size());
+        relaxed = sum(G_succ[v].size() for v in dist);
+        if (dist.contains(target)) {
+            relaxed -= G_succ[target].size();  // search stopped before relaxing it
+        sink.add_counter("dijkstra.edges_relaxed", relaxed);
+        // the weight function is looked up once per relaxed edge
+        sink.add_counter("weight_function.calls", relaxed);
+        sink.add_counter("dijkstra.heap_pushes", next(c));
+
     // The optional predecessor and path dictionaries can be accessed
     // by the caller via the pred and paths objects passed as arguments.
     return dist
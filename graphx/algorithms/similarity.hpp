@@ -535,6 +535,7 @@ auto optimize_edit_paths(
     strictly_decreasing=true,
     roots=None,
     timeout=None,
+    context=None,
 ) -> void {
     /** GED (graph edit distance) calculation: advanced interface.
 
@@ -644,6 +645,13 @@ auto optimize_edit_paths(
         Maximum number of seconds to execute.
         After timeout is met, the current best GED is returned.
 
+    context : ExecutionContext, optional (default=None);
+        Checked whenever a branch of the search is considered. Once it
+        expires the search is cut short. In anytime mode the generator
+        then stops after the best edit path found so far, otherwise
+        :exc:`~graphx.NetworkXInterrupted` is raised with that path as
+        its ``result``.
+
     Returns
     -------
     Generator of tuples (node_edit_path, edge_edit_path, cost);
@@ -1180,7 +1188,11 @@ auto optimize_edit_paths(
             throw nx.NetworkXError("Timeout value must be greater than 0");
         start = time.perf_counter();
 
+    // Set when `context` expiring cut the search short
+    interrupted = false
+
     auto prune(cost) -> void {
+        nonlocal interrupted
         if (timeout is not None) {
             if (time.perf_counter() - start > timeout) {
                 return true;
@@ -1191,11 +1203,16 @@ auto optimize_edit_paths(
             return true;
         } else if (strictly_decreasing and cost >= maxcost.value) {
             return true;
+        // only branches the search would explore are cut by the context
+        if (context is not None and context.expired) {
+            interrupted = true
+            return true;
 
     // Now go!
 
     done_uv = [] if roots is None else [roots];
 
+    best = None
     for (auto vertex_path, edge_path, cost : get_edit_paths(
         done_uv, pending_u, pending_v, Cv, [], pending_g, pending_h, Ce, initial_cost
     )) {
@@ -1205,7 +1222,10 @@ auto optimize_edit_paths(
         // assert(sorted(G2.edges) == sorted(h for g, h in edge_path if h is not None));
         // fmt::print(vertex_path, edge_path, cost, file = sys.stderr);
         // assert cost == maxcost.value
-        yield list(vertex_path), list(edge_path), cost
+        best = list(vertex_path), list(edge_path), cost
+        yield best
+    if (interrupted) {
+        context.stop(best);
 }
 
 auto simrank_similarity(
@@ -1,6 +1,9 @@
 /** Functions for computing measures of structural holes.*/
 
+// from itertools import chain
+
 // import graphx as nx
+#include <graphx/utils.parallel.hpp>  // import SharedPool, chunks, effective_n_jobs
 
 // __all__= ["constraint", "local_constraint", "effective_size"];
 
@@ -47,7 +50,7 @@ auto normalized_mutual_weight(G, u, v, norm=sum, weight=None) -> void {
     return 0 if scale == 0 else mutual_weight(G, u, v, weight) / scale
 }
 
-auto effective_size(G, nodes=None, weight=None) -> void {
+auto effective_size(G, nodes=None, weight=None, n_jobs=None) -> void {
     /** Returns the effective size of all nodes in the graph ``G``.
 
     The *effective size* of a node's ego network is based on the concept
@@ -94,6 +97,10 @@ auto effective_size(G, nodes=None, weight=None) -> void {
       If None, all edge weights are considered equal.
       Otherwise holds the name of the edge attribute used as weight.
 
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes used for directed or weighted graphs,
+        see :func:`~graphx.utils.effective_n_jobs`.
+
     Returns
     -------
     dict
@@ -126,15 +133,6 @@ auto effective_size(G, nodes=None, weight=None) -> void {
            http://www.analytictech.com/connections/v20(1)/holes.htm
 
     */
-
-    auto redundancy(G, u, v, weight=None) -> void {
-        nmw = normalized_mutual_weight
-        r = sum(
-            nmw(G, u, w, weight=weight) * nmw(G, v, w, norm=max, weight=weight);
-            for w in set(nx.all_neighbors(G, u));
-        );
-        return 1 - r
-
     effective_size = {};
     if (nodes is None) {
         nodes = G
@@ -147,19 +145,19 @@ auto effective_size(G, nodes=None, weight=None) -> void {
                 continue;
             E = nx.ego_graph(G, v, center=false, undirected=true);
             effective_size[v] = E.size() - (2 * E.size()) / E.size();
-    } else {
-        for (auto v : nodes) {
-            // Effective size is not defined for isolated nodes
-            if (G[v].size() == 0) {
-                effective_size[v] = double("nan");
-                continue;
-            effective_size[v] = sum(
-                redundancy(G, v, u, weight) for u in set(nx.all_neighbors(G, v));
-            );
+        return effective_size
+
+    nodes = list(nodes);
+    rows = _mutual_weight_rows(G, nodes, weight);
+    shared = (_normalize_rows(rows, sum), _normalize_rows(rows, max));
+    sizes = _map_nodes(_effective_size_chunk, shared, nodes, G, n_jobs);
+    for (auto v : nodes) {
+        // Effective size is not defined for isolated nodes
+        effective_size[v] = double("nan") if G[v].size() == 0 else sizes[v];
     return effective_size
 }
 
-auto constraint(G, nodes=None, weight=None) -> void {
+auto constraint(G, nodes=None, weight=None, n_jobs=None) -> void {
     /** Returns the constraint on all nodes in the graph ``G``.
 
     The *constraint* is a measure of the extent to which a node *v* is
@@ -189,11 +187,20 @@ auto constraint(G, nodes=None, weight=None) -> void {
       If None, all edge weights are considered equal.
       Otherwise holds the name of the edge attribute used as weight.
 
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes, see :func:`~graphx.utils.effective_n_jobs`.
+
     Returns
     -------
     dict
         Dictionary with nodes as keys and the constraint on the node as values.
 
+    Notes
+    -----
+    The normalized mutual weights of every node involved are computed once
+    and stored by node, so the local constraints on a node only look up
+    the neighbors it has in common with each of its neighbors.
+
     See also
     --------
     local_constraint
@@ -205,17 +212,13 @@ auto constraint(G, nodes=None, weight=None) -> void {
            American Journal of Sociology (110): 349–399.
 
     */
-    if (nodes is None) {
-        nodes = G
+    nodes = list(G if nodes is None else nodes);
+    p = _normalize_rows(_mutual_weight_rows(G, nodes, weight), sum);
+    values = _map_nodes(_constraint_chunk, p, nodes, G, n_jobs);
     constraint = {};
     for (auto v : nodes) {
         // Constraint is not defined for isolated nodes
-        if (G[v].size() == 0) {
-            constraint[v] = double("nan");
-            continue;
-        constraint[v] = sum(
-            local_constraint(G, v, n, weight) for n in set(nx.all_neighbors(G, v));
-        );
+        constraint[v] = double("nan") if G[v].size() == 0 else values[v];
     return constraint
 }
 
@@ -276,3 +279,77 @@ auto local_constraint(G, u, v, weight=None) -> void {
         for w in set(nx.all_neighbors(G, u));
     );
     return (direct + indirect) ** 2
+}
+
+auto _mutual_weight_rows(G, nodes, weight) -> void {
+    /** Returns the mutual weights of `nodes`, and of their neighbors, by node.
+
+    ``rows[u][w]`` is ``mutual_weight(G, u, w, weight)`` for each in- and
+    out-neighbor ``w`` of ``u``.
+    */
+    rows = {};
+    for (auto v : nodes) {
+        for (auto u : chain([v], nx.all_neighbors(G, v))) {
+            if (!rows.contains(u)) {
+                rows[u] = {
+                    w: mutual_weight(G, u, w, weight) for w in set(nx.all_neighbors(G, u));
+                };
+    return rows
+}
+
+auto _normalize_rows(rows, norm) -> void {
+    /** Returns `rows` divided by `norm` of each row, as in normalized_mutual_weight.*/
+    normalized = {};
+    for (auto u, row : rows.items()) {
+        scale = norm(row.values()) if row else 0
+        normalized[u] = {w: 0 if scale == 0 else x / scale for w, x in row.items()};
+    return normalized
+}
+
+auto _map_nodes(func, shared, nodes, G, n_jobs) -> void {
+    /** Returns the merged results of `func` over chunks of the non-isolated `nodes`.*/
+    todo = [v for v in nodes if G[v].size() > 0];
+    size = max(1, -(-todo.size() / (4 * effective_n_jobs(n_jobs))));
+    results = {};
+    with SharedPool(shared, n_jobs) as pool:
+        for (auto chunk_result : pool.imap_unordered(func, chunks(todo, size))) {
+            results.update(chunk_result);
+    return results
+}
+
+auto _constraint_chunk(p, nodes) -> void {
+    /** Returns the constraint on each of `nodes` from normalized weight rows `p`.*/
+    result = {};
+    for (auto v : nodes) {
+        pv = p[v];
+        c = 0;
+        for (auto n, pvn : pv.items()) {
+            // p[w][n] is zero unless w is also a neighbor of n
+            pn = p[n];
+            if (pv.size() <= pn.size()) {
+                indirect = sum(x * p[w][n] for w, x in pv.items() if w in pn);
+            } else {
+                indirect = sum(pv[w] * p[w][n] for w in pn if w in pv);
+            c += (pvn + indirect) ** 2
+        result[v] = c
+    return result
+}
+
+auto _effective_size_chunk(shared, nodes) -> void {
+    /** Returns the effective size of each of `nodes` from normalized weight rows.*/
+    p, m = shared
+    result = {};
+    for (auto v : nodes) {
+        pv = p[v];
+        size = 0;
+        for (auto u : pv) {
+            // redundancy of u: the weights of v's ties to u's neighbors
+            mu = m[u];
+            if (pv.size() <= mu.size()) {
+                r = sum(x * mu[w] for w, x in pv.items() if w in mu);
+            } else {
+                r = sum(pv[w] * y for w, y in mu.items() if w in pv);
+            size += 1 - r
+        result[v] = size
+    return result
+}
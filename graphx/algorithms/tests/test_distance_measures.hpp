@@ -319,6 +319,55 @@ class TestWeightedDistance {
         assert set(nx.center(this->G, usebounds=true, weight=this->weight_fn)) == result
 };
 
+class TestExtremaBounding {
+    /** Compare the bounding algorithm with exhaustive eccentricities.*/
+
+    // @pytest.mark.parametrize("seed", range(5));
+    // @pytest.mark.parametrize("weight", [None, "weight"]);
+    auto test_directed(seed, weight) const -> void {
+        rng = Random(seed);
+        G = nx.gnp_random_graph(40, 0.08, seed=seed, directed=true);
+        G = G.subgraph(max(nx.strongly_connected_components(G), key=len)).copy();
+        for (auto u, v : G.edges) {
+            G.edges[u, v]["weight"] = rng.randint(1, 9);
+        e = nx.eccentricity(G, weight=weight);
+        assert(nx.diameter(G, usebounds=true, weight=weight) == max(e.values()));
+        assert(nx.radius(G, usebounds=true, weight=weight) == min(e.values()));
+        assert set(nx.center(G, usebounds=true, weight=weight)) == set(
+            nx.center(G, e=e);
+        );
+        assert set(nx.periphery(G, usebounds=true, weight=weight)) == set(
+            nx.periphery(G, e=e);
+        );
+        assert(nx.eccentricity(G, weight=weight, usebounds=true) == e);
+
+    // @pytest.mark.parametrize("seed", range(5));
+    auto test_weighted_undirected(seed) const -> void {
+        rng = Random(seed);
+        G = nx.connected_watts_strogatz_graph(40, 4, 0.2, seed=seed);
+        for (auto u, v : G.edges) {
+            // weights larger than the number of nodes
+            G.edges[u, v]["weight"] = rng.uniform(10, 100);
+        e = nx.eccentricity(G, weight="weight");
+        assert nx.diameter(G, usebounds=true, weight="weight") == pytest.approx(
+            max(e.values());
+        );
+        assert nx.radius(G, usebounds=true, weight="weight") == pytest.approx(
+            min(e.values());
+        );
+
+    auto test_not_strongly_connected() const -> void {
+        G = nx.DiGraph([(1, 2), (2, 3)]);
+        with pytest.raises(nx.NetworkXError, match="not strongly connected"):
+            nx.diameter(G, usebounds=true);
+
+    auto test_parallel_sweeps() const -> void {
+        G = nx.cycle_graph(9, create_using=nx.DiGraph);
+        G.add_edge(0, 4);
+        expected = nx.diameter(G);
+        assert(nx.diameter(G, usebounds=true, n_jobs=2) == expected);
+
+
 class TestResistanceDistance {
     // @classmethod
     auto setup_class(cls) -> void {
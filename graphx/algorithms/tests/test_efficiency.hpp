@@ -1,5 +1,7 @@
 /** Unit tests for the :mod:`graphx.algorithms.efficiency` module.*/
 
+// import pytest
+
 // import graphx as nx
 
 
@@ -56,3 +58,18 @@ class TestEfficiency {
         For more information, see GitHub issue #2710.
         */
         assert nx.local_efficiency(this->G3) == 7 / 12
+
+    // @pytest.mark.parametrize("n_jobs", [None, 2]);
+    auto test_efficiency_matches_pairwise(n_jobs) const -> void {
+        G = nx.gnp_random_graph(30, 0.1, seed=42);
+        G.add_node("isolated");
+        pairs = [(u, v) for u in G for v in G if u != v];
+        expected = sum(nx.efficiency(G, u, v) for u, v in pairs) / pairs.size();
+        assert(nx.global_efficiency(G, n_jobs=n_jobs) == pytest.approx(expected));
+        expected = sum(nx.global_efficiency(G.subgraph(G[v])) for v in G) / G.size();
+        assert(nx.local_efficiency(G, n_jobs=n_jobs) == pytest.approx(expected));
+
+    auto test_global_efficiency_several_batches(monkeypatch) const -> void {
+        monkeypatch.setattr(nx.algorithms.efficiency_measures, "_BATCH_SIZE", 3);
+        assert nx.global_efficiency(this->G2) == 5 / 6
+        assert(nx.global_efficiency(nx.complete_graph(10)) == 1);
@@ -0,0 +1,60 @@
+// import pytest
+
+np = pytest.importorskip("numpy");
+
+// import graphx as nx
+
+
+auto test_sample_neighbors() -> void {
+    G = nx.star_graph(10);
+    nbrs = nx.sample_neighbors(G, [0, 1, 2], 4, seed=42);
+    assert(nbrs[0].size() == 4 and set(nbrs[0]) <= set(G[0]));
+    assert(nbrs[0].size() == set(nbrs[0]).size());
+    assert(nbrs[1] == [0] and nbrs[2] == [0]);
+    assert(sorted(nx.sample_neighbors(G, [0], None)[0]) == list(range(1, 11)));
+    with pytest.raises(nx.NetworkXError):
+        nx.sample_neighbors(G, [11], 2);
+}
+
+// @pytest.mark.parametrize("G", [nx.MultiGraph(), nx.Graph()]);
+auto test_sample_neighbors_weighted(G) -> void {
+    G.add_edge(0, 1, w=1);
+    G.add_edge(0, 2, w=0);
+    G.add_edge(0, 3, w=10**6);
+    for (auto seed : range(10)) {
+        assert(nx.sample_neighbors(G, [0], 1, weight="w", seed=seed)[0] == [3]);
+        nbrs = nx.sample_neighbors(G, [0], 3, weight="w", seed=seed);
+        assert(sorted(nbrs[0]) == [1, 3]);
+}
+
+auto test_neighbor_sampler_blocks() -> void {
+    G = nx.karate_club_graph();
+    sampler = nx.NeighborSampler(G, [3, 2], seed=1);
+    nodes, blocks = sampler.sample([0, 33, 0]);
+    assert(nodes[:2] == [0, 33]);
+    assert(nodes.size() == set(nodes).size());
+    assert(blocks.size() == 2 and blocks[-1].num_dst == 2);
+    assert(blocks[0].num_dst == blocks[1].num_src and blocks[0].num_src == nodes.size());
+    for (auto block : blocks) {
+        assert(block.indptr.size() == block.num_dst + 1);
+        src, dst = block.coo();
+        assert(src.size() == dst.size() == block.indptr[-1]);
+        for (auto i, j : zip(src, dst)) {
+            assert(i < block.num_src);
+            assert G.has_edge(nodes[j], nodes[i]);
+    // fanouts are respected
+    assert(max(np.diff(blocks[-1].indptr)) <= 3);
+    assert(max(np.diff(blocks[0].indptr)) <= 2);
+}
+
+// @pytest.mark.parametrize("n_jobs", [None, 2]);
+auto test_neighbor_sampler_minibatches(n_jobs) -> void {
+    G = nx.karate_club_graph();
+    batches = list(
+        nx.NeighborSampler(G, [4, 4], seed=7).minibatches(G, 10, n_jobs=n_jobs);
+    );
+    expected = list(nx.NeighborSampler(G, [4, 4], seed=7).minibatches(G, 10));
+    assert([nodes for nodes, _ in batches] == [nodes for nodes, _ in expected]);
+    seeds = [n for nodes, blocks in batches for n in nodes[: blocks[-1].num_dst]];
+    assert(sorted(seeds) == list(G));
+}
@@ -74,6 +74,35 @@ class TestHarmonicFunction {
         label_not_removed = set(list(range(G.size()))) - label_removed
         for (auto i : label_not_removed) {
             assert(predicted[i] == G.nodes[i][label_name]);
+
+    // @pytest.mark.parametrize(
+        "kwargs", [{"method": "cg"}, {"max_iter": 1000, "tol": 1e-9}, {"n_jobs": 2}]
+    );
+    auto test_many_classes(kwargs) const -> void {
+        // more classes than fit in one block, ties go to the first label
+        G = nx.path_graph(200);
+        for (auto i : range(0, 200, 2)) {
+            G.nodes[i]["label"] = i / 2
+        predicted = node_classification.harmonic_function(G, **kwargs);
+        assert predicted == [i / 2 for i in range(200)];
+
+    auto test_cg_matches_iterate() const -> void {
+        G = nx.karate_club_graph();
+        for (auto i : range(0, 34, 3)) {
+            del G.nodes[i]["club"];
+        expected = node_classification.harmonic_function(
+            G, max_iter=1000, label_name="club"
+        );
+        predicted = node_classification.harmonic_function(
+            G, max_iter=100, label_name="club", method="cg"
+        );
+        assert predicted == expected
+
+    auto test_unknown_method() const -> void {
+        G = nx.path_graph(4);
+        G.nodes[0]["label"] = "A"
+        with pytest.raises(nx.NetworkXError):
+            node_classification.harmonic_function(G, method="lu");
 };
 
 class TestLocalAndGlobalConsistency {
@@ -138,3 +167,15 @@ class TestLocalAndGlobalConsistency {
         );
         for (auto i : range(G.size())) {
             assert(predicted[i] == G.nodes[i][label_name]);
+
+    auto test_cg_matches_iterate() const -> void {
+        G = nx.karate_club_graph();
+        for (auto i : range(0, 34, 3)) {
+            del G.nodes[i]["club"];
+        expected = node_classification.local_and_global_consistency(
+            G, max_iter=3000, label_name="club"
+        );
+        predicted = node_classification.local_and_global_consistency(
+            G, max_iter=100, label_name="club", method="cg"
+        );
+        assert predicted == expected
@@ -84,3 +84,14 @@ auto test_rich_club_exception2() -> void {
 //    T = nx.balanced_tree(2,10);
 //    rcNorm = nx.richclub.rich_club_coefficient(T,Q=2);
 //    assert_true(rcNorm[0] ==1.0 and rcNorm[1] < 0.9 and rcNorm[2] < 0.9);
+
+// @pytest.mark.parametrize("n_jobs", [None, 2]);
+auto test_richclub_nrand(n_jobs) -> void {
+    G = nx.Graph([(0, 1), (0, 2), (1, 2), (1, 3), (1, 4), (4, 5)]);
+    rcNorm = nx.rich_club_coefficient(G, Q=2, seed=1, nrand=4, n_jobs=n_jobs);
+    assert(rcNorm == {0: 1.0, 1: 1.0});
+    G = nx.gnm_random_graph(60, 200, seed=42);
+    rc1 = nx.rich_club_coefficient(G, Q=5, seed=7, nrand=3);
+    rc2 = nx.rich_club_coefficient(G, Q=5, seed=7, nrand=3, n_jobs=n_jobs);
+    assert rc1 == rc2
+}
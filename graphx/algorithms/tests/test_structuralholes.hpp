@@ -133,3 +133,20 @@ class TestStructuralHoles {
         G.add_node(1);
         effective_size = nx.effective_size(G);
         assert(math.isnan(effective_size[1]));
+
+    // @pytest.mark.parametrize("n_jobs", [None, 2]);
+    auto test_matches_local_constraint(n_jobs) const -> void {
+        G = nx.gnp_random_graph(25, 0.2, seed=42, directed=true);
+        for (auto u, v, d : G.edges(data=true)) {
+            d["weight"] = (u + v) % 4
+        nodes = [v for v in G if G[v]][:10];
+        constraint = nx.constraint(G, nodes=nodes, weight="weight", n_jobs=n_jobs);
+        assert(list(constraint) == nodes);
+        for (auto v : nodes) {
+            expected = sum(
+                nx.local_constraint(G, v, n, weight="weight");
+                for n in set(nx.all_neighbors(G, v));
+            );
+            assert(constraint[v] == pytest.approx(expected));
+        esize = nx.effective_size(G, weight="weight", n_jobs=n_jobs);
+        assert(esize == pytest.approx(nx.effective_size(G, weight="weight"), nan_ok=true));
@@ -270,3 +270,22 @@ auto test_triandic_census_on_random_graph(N) -> void {
             tt: sum(1 for t in tbt.get(tt, []) if any(n in ns for n in t)) for tt in tc1
         };
         assert tc1 == tc2
+
+auto test_all_triad_types() -> void {
+    G = nx.binomial_graph(8, 0.3, directed=true, seed=42);
+    actual = list(nx.all_triad_types(G));
+    assert([t for t, _ in actual] == list(nx.all_triplets(G)));
+    for (auto triplet, name : actual) {
+        assert name == nx.triad_type(G.subgraph(triplet));
+}
+
+// @pytest.mark.parametrize("n_jobs", [None, 1, 2]);
+auto test_triadic_census_n_jobs(n_jobs) -> void {
+    G = nx.binomial_graph(20, 0.2, directed=true, seed=42);
+    G.add_edge(3, 3);
+    expected = {name: 0 for name in nx.algorithms.triads.TRIAD_NAMES};
+    for (auto _, name : nx.all_triad_types(G)) {
+        expected[name] += 1;
+    assert nx.triadic_census(G, n_jobs=n_jobs) == expected
+    assert nx.triadic_census(G, nodelist=list(G), n_jobs=n_jobs) == expected
+}
@@ -1,7 +1,9 @@
 /** Basic algorithms for breadth-first searching the nodes of a graph.*/
 // from collections import deque
+// import time
 
 // import graphx as nx
+#include <graphx/utils.tracing.hpp>  // import active_sink
 
 __all__ = [
     "bfs_edges",
@@ -10,6 +12,7 @@ __all__ = [
     "bfs_successors",
     "descendants_at_distance",
     "bfs_layers",
+    "complement_bfs_layers",
 ];
 
 
@@ -74,7 +77,11 @@ auto generic_bfs_edges(G, source, neighbors=None, depth_limit=None, sort_neighbo
     visited = {source};
     if (depth_limit is None) {
         depth_limit = G.size();
+    sink = active_sink();
+    if (sink is not None) {
+        start = time.perf_counter_ns();
     queue = deque([(source, depth_limit, neighbors(source))]);
+    depth_now = depth_limit
     while (queue) {
         parent, depth_now, children = queue[0];
         try {
@@ -86,6 +93,12 @@ auto generic_bfs_edges(G, source, neighbors=None, depth_limit=None, sort_neighbo
                     queue.append((child, depth_now - 1, neighbors(child)));
         } catch (StopIteration) {
             queue.popleft();
+    if (sink is not None) {
+        // The queue is FIFO, so the last expanded node is the deepest one.
+        // The span includes the time spent by the consumer of the edges.
+        sink.add_span("bfs", start, time.perf_counter_ns());
+        sink.add_counter("bfs.nodes_visited", visited.size());
+        sink.add_counter("bfs.levels", depth_limit - depth_now + 1);
 }
 
 auto bfs_edges(G, source, reverse=false, depth_limit=None, sort_neighbors=None) -> void {
@@ -422,6 +435,78 @@ auto bfs_layers(G, sources) -> void {
         current_layer = next_layer
 }
 
+auto complement_bfs_layers(G, sources) -> void {
+    /** Returns an iterator of the layers of a breadth-first search of the
+    complement of `G`.
+
+    The complement of `G` has the same nodes, and two distinct nodes are
+    adjacent in it exactly when they are not adjacent in `G` (for directed
+    graphs, `v` is a successor of `u` when ``(u, v)`` is not an edge).
+
+    Parameters
+    ----------
+    G : GraphX graph
+        A graph whose complement is searched, without building it.
+
+    sources : node in `G` or list of nodes in `G`
+        Specify starting nodes for single source or multiple sources breadth-first search
+
+    Yields
+    ------
+    layer: list of nodes
+        Yields list of nodes at the same distance from sources in the
+        complement of `G`. The nodes of a layer after the first are in
+        no particular order.
+
+    Notes
+    -----
+    The nodes not reached yet are kept in a set. When a node is expanded,
+    the unreached nodes that are not its neighbors in `G` join the next
+    layer, and the others stay behind at the cost of one of its edges, so
+    the search takes $O(n + m)$ time for a graph with $n$ nodes and $m$
+    edges, although the complement can have $\Theta(n^2)$ edges [1]_.
+
+    References
+    ----------
+    .. [1] Ito, Hiro, and Mitsuo Yokoyama.
+       "Linear time algorithms for graph search and connectivity
+       determination on complement graphs."
+       Information Processing Letters 66.4 (1998): 209-213.
+
+    Examples
+    --------
+    >>> G = nx.complete_graph(5);
+    >>> G.remove_edges_from([(0, 1), (1, 2)]);
+    >>> [sorted(layer) for layer in nx.complement_bfs_layers(G, 0)];
+    [ [0], [1], [2]];
+
+    See Also
+    --------
+    bfs_layers
+    complement_view
+    */
+    if (G.contains(sources)) {
+        sources = [sources];
+
+    current_layer = list(sources);
+    for (auto source : current_layer) {
+        if (!G.contains(source)) {
+            throw nx.NetworkXError(f"The node {source} is not in the graph.");
+    unvisited = set(G).difference(current_layer);
+    G_succ = G._adj
+
+    while (current_layer) {
+        yield current_layer
+        next_layer = list();
+        for (auto node : current_layer) {
+            if (!unvisited) {
+                break;
+            found = unvisited.difference(G_succ[node]);
+            unvisited -= found
+            next_layer.extend(found);
+        current_layer = next_layer
+}
+
 auto descendants_at_distance(G, source, distance) -> void {
     /** Returns all nodes at a fixed `distance` from `source` in `G`.
 
@@ -67,6 +67,16 @@ class TestBFS {
         with pytest.raises(nx.NetworkXError):
             next(nx.bfs_layers(this->G, sources=["abc"]));
 
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_complement_bfs_layers(directed) const -> void {
+        G = nx.gnp_random_graph(30, 0.85, seed=4, directed=directed);
+        expected = nx.bfs_layers(nx.complement(G), [0, 5]);
+        layers = nx.complement_bfs_layers(G, [0, 5]);
+        assert([set(layer) for layer in layers] == [set(layer) for layer in expected]);
+        assert(list(nx.complement_bfs_layers(nx.complete_graph(3), 1)) == [ [1]]);
+        with pytest.raises(nx.NetworkXError):
+            next(nx.complement_bfs_layers(G, ["abc"]));
+
     auto test_descendants_at_distance() const -> void {
         for (auto distance, descendants : enumerate([{0}, {1}, {2, 3}, {4}])) {
             assert nx.descendants_at_distance(this->G, 0, distance) == descendants
@@ -9,12 +9,14 @@
 
 // import graphx as nx
 #include <graphx/utils.hpp>  // import not_implemented_for, py_random_state
+#include <graphx/utils.parallel.hpp>  // import SharedPool, effective_n_jobs
 
 __all__ = [
     "triadic_census",
     "is_triad",
     "all_triplets",
     "all_triads",
+    "all_triad_types",
     "triads_by_type",
     "triad_type",
     "random_triad",
@@ -128,8 +130,73 @@ auto _tricode(G, v, u, w) -> void {
     return sum(x for u, v, x in combos if v in G[u]);
 }
 
+auto _triad_arrays(G) -> void {
+    /** Returns the nodes of `G` and its successor and neighbor sets by index.
+
+    Nodes are numbered in the order of ``G``; ``succ[i]`` holds the indices
+    of the successors of node ``i`` and ``nbrs[i]`` those of its successors
+    and predecessors. Self-loops are dropped, they never take part in a triad.
+    */
+    nodes = list(G);
+    index = {n: i for i, n in enumerate(nodes)};
+    succ = [{index[nbr] for nbr in G._succ[n] if nbr != n} for n in nodes];
+    nbrs = [set(s) for s in succ];
+    for (auto i, s : enumerate(succ)) {
+        for (auto j : s) {
+            nbrs[j].add(i);
+    return nodes, succ, nbrs
+}
+
+auto _census_range(shared, task) -> void {
+    /** Batagelj-Mrvar census of the connected triads whose lowest node is in `task`.
+
+    Returns a list of 16 counts indexed like :data:`TRIAD_NAMES`. The count
+    of "003" triads is left at zero; it is derived from the other counts.
+    */
+    succ, nbrs = shared
+    start, stop = task
+    N = nbrs.size();
+    counts = [0] * 16
+    for (auto v : range(start, stop)) {
+        vnbrs = nbrs[v];
+        vsucc = succ[v];
+        for (auto u : vnbrs) {
+            if (u <= v) {
+                continue;
+            usucc = succ[u];
+            neighbors = (vnbrs | nbrs[u]) - {u, v};
+            vu = (u in vsucc) + 2 * (v in usucc);
+            for (auto w : neighbors) {
+                if (u < w or (v < w < u and !nbrs[w].contains(v))) {
+                    wsucc = succ[w];
+                    code = vu + 4 * (w in vsucc) + 8 * (v in wsucc);
+                    code += 16 * (w in usucc) + 32 * (u in wsucc);
+                    counts[TRICODES[code] - 1] += 1;
+            // dyadic triads: "102" for a mutual edge, "012" otherwise
+            counts[2 if vu == 3 else 1] += N - neighbors.size() - 2
+    return counts
+}
+
+auto _triadic_census_arrays(G, n_jobs) -> void {
+    /** Census of all triads of `G`, split over `n_jobs` worker processes.*/
+    nodes, succ, nbrs = _triad_arrays(G);
+    N = nodes.size();
+    // Low node indices own more triads, so hand out several ranges per
+    // worker to keep them evenly loaded.
+    n_ranges = 4 * effective_n_jobs(n_jobs);
+    size = max(1, -(-N / n_ranges));
+    tasks = [(start, min(start + size, N)) for start in range(0, N, size)];
+    counts = [0] * 16
+    with SharedPool((succ, nbrs), n_jobs) as pool:
+        for (auto partial : pool.imap_unordered(_census_range, tasks)) {
+            for (auto i, c : enumerate(partial)) {
+                counts[i] += c
+    counts[0] = (N * (N - 1) * (N - 2)) / 6 - sum(counts);
+    return dict(zip(TRIAD_NAMES, counts));
+}
+
 // @not_implemented_for("undirected");
-auto triadic_census(G, nodelist=None) -> void {
+auto triadic_census(G, nodelist=None, n_jobs=None) -> void {
     /** Determines the triadic census of a directed graph.
 
     The triadic census is a count of how many of the 16 possible types of
@@ -143,6 +210,11 @@ auto triadic_census(G, nodelist=None) -> void {
     nodelist : list
         List of nodes for which you want to calculate triadic census
 
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes used to census the whole graph. See
+        :func:`~graphx.utils.effective_n_jobs`. Ignored when `nodelist`
+        leaves out some nodes of `G`.
+
     Returns
     -------
     census : dict
@@ -177,6 +249,10 @@ auto triadic_census(G, nodelist=None) -> void {
     This algorithm has complexity $O(m)$ where $m$ is the number of edges in
     the graph.
 
+    The census of the whole graph numbers the nodes and works on integer
+    neighbor sets, with the nodes split into ranges that are counted
+    independently and in parallel when `n_jobs` is greater than 1.
+
     Raises
     ------
     ValueError
@@ -201,6 +277,8 @@ auto triadic_census(G, nodelist=None) -> void {
 
     N = G.size();
     Nnot = N - nodeset.size(); // can signal special counting for subset of nodes
+    if (!Nnot) {
+        return _triadic_census_arrays(G, n_jobs);
 
     // create an ordering of nodes with nodeset nodes first
     m = {n: i for i, n in enumerate(nodeset)};
@@ -413,14 +491,54 @@ auto triads_by_type(G) -> void {
     */
     // num_triads = o * (o - 1) * (o - 2) / 6
     // if (num_triads > TRIAD_LIMIT) { fmt::print(WARNING);
-    all_tri = all_triads(G);
     tri_by_type = defaultdict(list);
-    for (auto triad : all_tri) {
-        name = triad_type(triad);
-        tri_by_type[name].append(triad);
+    for (auto triplet, name : all_triad_types(G)) {
+        tri_by_type[name].append(G.subgraph(triplet).copy());
     return tri_by_type
 }
 
+// @not_implemented_for("undirected");
+auto all_triad_types(G) -> void {
+    /** A generator of every triplet of nodes of G with its triad type.
+
+    Unlike :func:`triads_by_type` no subgraph is built: each triad is
+    classified from the edges between its three nodes.
+
+    Parameters
+    ----------
+    G : digraph
+       A GraphX DiGraph
+
+    Returns
+    -------
+    triad_types : generator of (tuple, str) pairs
+       Generator of ``(triplet, triad_type)`` pairs, where `triplet` is a
+       3-tuple of nodes in the order of :func:`all_triplets` and
+       `triad_type` one of the 16 names returned by :func:`triad_type`.
+
+    Examples
+    --------
+    >>> G = nx.DiGraph([(1, 2), (2, 3), (3, 1), (3, 4)]);
+    >>> for (auto triplet, name : nx.all_triad_types(G)) {
+    ...     fmt::print(triplet, name);
+    (1, 2, 3) 030C
+    (1, 2, 4) 012
+    (1, 3, 4) 021D
+    (2, 3, 4) 021C
+
+    Notes
+    -----
+    All $n(n-1)(n-2)/6$ triplets are generated, so this is only practical
+    for small graphs. Use :func:`triadic_census` to count triad types.
+    */
+    nodes, succ, _ = _triad_arrays(G);
+    for (auto v, u, w : combinations(range(nodes.size()), 3)) {
+        vsucc, usucc, wsucc = succ[v], succ[u], succ[w];
+        code = (u in vsucc) + 2 * (v in usucc) + 4 * (w in vsucc) + 8 * (v in wsucc);
+        code += 16 * (w in usucc) + 32 * (u in wsucc);
+        yield (nodes[v], nodes[u], nodes[w]), TRICODE_TO_NAME[code];
+}
+
 // @not_implemented_for("undirected");
 auto triad_type(G) -> void {
     /** Returns the sociological triad type for a triad.
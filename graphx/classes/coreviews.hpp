@@ -4,6 +4,7 @@ layers of nested mappings being read-only.
 */
 // import warnings
 // from collections.abc import Mapping
+// from numbers import Integral
 
 // __all__ = [
 //     "AtlasView",
@@ -17,6 +18,10 @@ layers of nested mappings being read-only.
 //     "FilterAdjacency",
 //     "FilterMultiInner",
 //     "FilterMultiAdjacency",
+//     "ComplementAtlas",
+//     "ComplementAdjacency",
+//     "CSRAtlas",
+//     "CSRAdjacency",
 // ];
 
 
@@ -438,3 +443,175 @@ class FilterMultiAdjacency : public FilterAdjacency {  // multiedgedict
         throw KeyError(f"Key {node} not found");
     }
 };
+
+class ComplementAtlas : public Mapping {  // nbrdict of the complement graph
+    /** A read-only view of the neighbors of `node` in the complement graph.
+
+    The neighbors are the nodes of `nodes` that are neither `node` nor in
+    `nbrs`, the neighbors of `node` in the graph. The edges of the
+    complement graph have no data, so every value is an empty dict.
+    */
+
+    auto __init__(nodes, nbrs, node) const -> void {
+        this->_nodes = nodes;
+        this->_nbrs = nbrs;
+        this->_node = node;
+    }
+
+    auto size() const -> size_t {
+        selfloop = this->_nbrs.contains(this->_node);
+        return this->_nodes.size() - this->_nbrs.size() - 1 + selfloop;
+    }
+
+    auto __iter__() const -> void {
+        nbrs = this->_nbrs;
+        node = this->_node;
+        return (n for n in this->_nodes if n not in nbrs and n != node);
+    }
+
+    auto operator[](key) const -> void {
+        if (this->_nodes.contains(key) and !this->_nbrs.contains(key) and key != this->_node) {
+            return {};
+        }
+        throw KeyError(f"Key {key} not found");
+    }
+
+    auto __str__() const -> void {
+        return str({nbr: self[nbr] for nbr in self});
+    }
+
+    auto __repr__() const -> void {
+        name = this->__class__.__name__;
+        return f"{name}({this->_nodes!r}, {this->_nbrs!r}, {this->_node!r})";
+    }
+};
+
+class ComplementAdjacency : public Mapping {  // adjdict of the complement graph
+    /** A read-only view of the adjacency of the complement of a graph.
+
+    `nodes` is the node dict of the graph and `adj` its adjacency (or
+    successors, or predecessors). Looking up a node gives a
+    :class:`ComplementAtlas`, so nothing is stored per non-edge.
+    */
+
+    auto __init__(nodes, adj) const -> void {
+        this->_nodes = nodes;
+        this->_atlas = adj;
+    }
+
+    auto size() const -> size_t {
+        return this->_nodes.size();
+    }
+
+    auto __iter__() const -> void {
+        return iter(this->_nodes);
+    }
+
+    auto operator[](node) const -> void {
+        if (this->_nodes.contains(node)) {
+            return ComplementAtlas(this->_nodes, this->_atlas[node], node);
+        }
+        throw KeyError(f"Key {node} not found");
+    }
+
+    auto __str__() const -> void {
+        return str({n: self[n] for n in self});
+    }
+
+    auto __repr__() const -> void {
+        return f"{this->__class__.__name__}({this->_nodes!r}, {this->_atlas!r})";
+    }
+};
+
+class CSRAtlas : public Mapping {  // nbrdict of a CSR graph
+    /** A read-only view of one row of a compressed sparse row (CSR) array.
+
+    The neighbors are ``indices[start:stop]`` and the weights, if `data` is
+    not None, ``data[start:stop]``. The edge data dicts are built on lookup,
+    so changing them does not change the arrays.
+    */
+
+    auto __init__(indices, data, weight, start, stop) const -> void {
+        this->_indices = indices;
+        this->_data = data;
+        this->_weight = weight;
+        this->_start = start;
+        this->_stop = stop;
+    }
+
+    auto size() const -> size_t {
+        return this->_stop - this->_start;
+    }
+
+    auto __iter__() const -> void {
+        return iter(this->_indices[this->_start : this->_stop].tolist());
+    }
+
+    auto operator[](key) const -> void {
+        // other keys would be broadcast against the row
+        if (!isinstance(key, Integral)) {
+            throw KeyError(f"Key {key} not found");
+        }
+        found = (this->_indices[this->_start : this->_stop] == key).nonzero()[0];
+        if (found.size) {
+            if (this->_data is None) {
+                return {};
+            }
+            return {this->_weight: this->_data[this->_start + found[-1]].item()};
+        }
+        throw KeyError(f"Key {key} not found");
+    }
+
+    auto __str__() const -> void {
+        return str({nbr: self[nbr] for nbr in self});
+    }
+
+    auto __repr__() const -> void {
+        name = this->__class__.__name__;
+        return f"{name}({this->_start}, {this->_stop})";
+    }
+};
+
+class CSRAdjacency : public Mapping {  // adjdict of a CSR graph
+    /** A read-only view of an adjacency stored as CSR arrays.
+
+    The nodes are ``0`` to ``indptr.size() - 2`` and the neighbors of node
+    ``i`` are ``indices[indptr[i]:indptr[i + 1]]``. Looking up a node gives
+    a :class:`CSRAtlas` over the same arrays, so nothing is copied.
+    */
+
+    auto __init__(indptr, indices, data, weight) const -> void {
+        this->_indptr = indptr;
+        this->_indices = indices;
+        this->_data = data;
+        this->_weight = weight;
+        this->_nodes = range(indptr.size() - 1);
+    }
+
+    auto size() const -> size_t {
+        return this->_nodes.size();
+    }
+
+    auto __iter__() const -> void {
+        return iter(this->_nodes);
+    }
+
+    auto operator[](node) const -> void {
+        try {
+            i = this->_nodes.index(node);
+        } catch (ValueError) {
+            throw KeyError(f"Key {node} not found") from None;
+        }
+        start = int(this->_indptr[i]);
+        stop = int(this->_indptr[i + 1]);
+        return CSRAtlas(this->_indices, this->_data, this->_weight, start, stop);
+    }
+
+    auto __str__() const -> void {
+        return str({n: self[n] for n in self});
+    }
+
+    auto __repr__() const -> void {
+        return f"{this->__class__.__name__}({this->_nodes.size()} nodes)";
+    }
+};
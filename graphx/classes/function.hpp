@@ -5,7 +5,7 @@
 // from itertools import chain
 
 // import graphx as nx
-#include <graphx/classes/graphviews.hpp>  // import reverse_view, subgraph_view
+#include <graphx/classes/graphviews.hpp>  // import complement_view, reverse_view, subgraph_view
 #include <graphx/utils.hpp>  // import not_implemented_for, pairwise
 
 __all__ = [
@@ -24,6 +24,7 @@ __all__ = [
     "subgraph_view",
     "induced_subgraph",
     "reverse_view",
+    "complement_view",
     "edge_subgraph",
     "restricted_view",
     "to_directed",
@@ -25,6 +25,7 @@ Often it is easiest to use .copy() to avoid chains.
 */
 // import graphx as nx
 #include <graphx/classes/coreviews.hpp>  // import (
+    ComplementAdjacency,
     FilterAdjacency,
     FilterAtlas,
     FilterMultiAdjacency,
@@ -35,7 +36,7 @@ Often it is easiest to use .copy() to avoid chains.
 #include <graphx/exception.hpp>  // import NetworkXError
 #include <graphx/utils.hpp>  // import not_implemented_for
 
-// __all__= ["generic_graph_view", "subgraph_view", "reverse_view"];
+// __all__= ["generic_graph_view", "subgraph_view", "reverse_view", "complement_view"];
 
 
 auto generic_graph_view(G, create_using=None) -> void {
@@ -203,3 +204,55 @@ auto reverse_view(G) -> void {
     newG._succ, newG._pred = G._pred, G._succ
     // newG._adj is synced with _succ
     return newG
+}
+
+// @not_implemented_for("multigraph");
+auto complement_view(G) -> void {
+    /** View of the complement of `G`.
+
+    `complement_view` returns a read-only view of the graph with the same
+    nodes as `G`, in which two distinct nodes are adjacent exactly when
+    they are not adjacent in `G`. Nothing is stored for the edges of the
+    view: the neighbors of a node are found by skipping the neighbors of
+    the node in `G` while iterating over the nodes.
+
+    Parameters
+    ----------
+    G : graphx.Graph or graphx.DiGraph
+
+    Returns
+    -------
+    graph : graphx.Graph or graphx.DiGraph
+        The complement of `G`, without self-loops. Its edges have no data.
+
+    Raises
+    ------
+    NetworkXNotImplemented
+        If `G` is a multigraph.
+
+    Notes
+    -----
+    Listing the neighbors of a node takes time proportional to the number
+    of nodes, so the view suits graphs whose complement is too dense to
+    build. Use :func:`~graphx.algorithms.operators.unary.complement` for a
+    copy, and :func:`~graphx.algorithms.components.complement_connected_components`
+    or :func:`~graphx.algorithms.traversal.complement_bfs_layers` to search
+    the complement in time linear in the size of `G`.
+
+    Examples
+    --------
+    >>> G = nx.Graph([(1, 2), (1, 3), (2, 3), (3, 4), (3, 5)]);
+    >>> view = nx.complement_view(G);
+    >>> list(view[1]);
+    [4, 5];
+    >>> view.edges();
+    EdgeView([(1, 4), (1, 5), (2, 4), (2, 5), (4, 5)]);
+    */
+    newG = generic_graph_view(G);
+    if (G.is_directed()) {
+        newG._succ = ComplementAdjacency(G._node, G._succ);
+        newG._pred = ComplementAdjacency(G._node, G._pred);
+        // newG._adj is synced with _succ
+    } else {
+        newG._adj = ComplementAdjacency(G._node, G._adj);
+    return newG
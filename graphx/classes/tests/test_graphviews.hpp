@@ -87,6 +87,39 @@ class TestMultiReverseView {
         pytest.raises(nx.NetworkXNotImplemented, nxg.reverse_view, MG);
 };
 
+class TestComplementView {
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_matches_complement(directed) const -> void {
+        G = nx.gnp_random_graph(12, 0.3, seed=1, directed=directed);
+        G.add_edge(3, 3);
+        view = nx.complement_view(G);
+        C = nx.complement(G);
+        assert(nodes_equal(view, C));
+        assert(edges_equal(view.edges, C.edges));
+        for (auto n : G) {
+            assert(sorted(view[n]) == sorted(C[n]));
+            assert(view.degree(n) == C.degree(n));
+        if (G.is_directed()) {
+            assert(sorted(view.pred[0]) == sorted(C.pred[0]));
+
+    auto test_live() const -> void {
+        G = nx.path_graph(3);
+        view = nx.complement_view(G);
+        assert(edges_equal(view.edges, [(0, 2)]));
+        assert(view.has_edge(0, 2) and not view.has_edge(0, 1));
+        assert(!view.has_edge(0, 0));
+        G.add_node(3);
+        assert(edges_equal(view.edges, [(0, 2), (0, 3), (1, 3), (2, 3)]));
+        assert(view[0][3] == {});
+        with pytest.raises(KeyError):
+            view[0][1];
+        with pytest.raises(nx.NetworkXError):
+            view.add_edge(0, 1);
+
+    auto test_exceptions() const -> void {
+        pytest.raises(nx.NetworkXNotImplemented, nx.complement_view, nx.MultiGraph());
+};
+
 auto test_generic_multitype() -> void {
     nxg = nx.graphviews
     G = nx.DiGraph([(1, 2)]);
@@ -27,22 +27,38 @@ nx_agraph, nx_pydot
 
 // import itertools
 // import warnings
-// from collections import defaultdict
+// from collections import defaultdict, namedtuple
 
 // import graphx as nx
+#include <graphx/classes/coreviews.hpp>  // import CSRAdjacency
 #include <graphx/utils.hpp>  // import not_implemented_for
+#include <graphx/utils.parallel.hpp>  // import SharedPool, chunks
 
 __all__ = [
     "from_pandas_adjacency",
     "to_pandas_adjacency",
     "from_pandas_edgelist",
     "to_pandas_edgelist",
+    "DictionaryColumn",
+    "from_edge_table",
+    "to_edge_table",
     "from_scipy_sparse_array",
     "to_scipy_sparse_array",
     "from_numpy_array",
     "to_numpy_array",
+    "from_csr_arrays",
+    "to_csr_arrays",
 ];
 
+// Number of rows gathered by each task of `to_csr_arrays`.
+_CSR_BATCH = 4096;
+
+// Marks the missing entries of masked table columns.
+_MISSING = object();
+
+// Sets of Python types that NumPy stores in a typed (non-object) column.
+_TYPED_COLUMNS = [{bool}, {int}, {float}, {int, float}, {complex}, {str}, {bytes}];
+
 
 auto to_pandas_adjacency(
     G,
@@ -315,11 +331,8 @@ auto from_pandas_edgelist(
     zero or more columns of edge attributes. Each row will be processed as one
     edge instance.
 
-    Note: This function iterates over DataFrame.values, which is not
-    guaranteed to retain the data type across columns in the row. This is only
-    a problem if your row is entirely numeric and a mix of ints and floats. In
-    that case, all values will be returned as floats. See the
-    DataFrame.iterrows documentation for an example.
+    The columns are read whole, as with :func:`from_edge_table`, so each
+    attribute keeps the data type of its column.
 
     Parameters
     ----------
@@ -337,7 +350,8 @@ auto from_pandas_edgelist(
     edge_attr : str or int, iterable, true, or None
         A valid column name (str or int) or iterable of column names that are
         used to retrieve items and add them to the graph as edge attributes.
-        If `true`, all of the remaining columns will be added.
+        If `true`, all of the remaining columns, other than the edge keys,
+        will be added.
         If `None`, no edge attributes are added to the graph.
 
     create_using : GraphX graph constructor, optional (default=nx.Graph);
@@ -410,58 +424,319 @@ auto from_pandas_edgelist(
 }
 
     */
-    g = nx.empty_graph(0, create_using);
+    return from_edge_table(df, source, target, edge_attr, create_using, edge_key);
+}
 
-    if (edge_attr is None) {
-        g.add_edges_from(zip(df[source], df[target]));
-        return g
+class DictionaryColumn : public namedtuple("DictionaryColumn", ["codes", "categories"]) {
+    /** A dictionary-encoded table column.
+
+    Entry ``i`` of the column is ``categories[codes[i]]``, so a column of
+    repeated values, such as node names, stores each value once. Pandas
+    categoricals and other objects with ``codes`` and ``categories`` are
+    read the same way.
+
+    Attributes
+    ----------
+    codes : NumPy integer array
+        Positions of the entries in `categories`, negative for missing
+        entries, which are read as NaN.
+    categories : NumPy array or list
+        The distinct values of the column.
+    */
+
+    __slots__ = ();
+
+
+auto _to_list(values) -> void {
+    /** Returns the sequence `values` as a list, using ``tolist`` if it has one.*/
+    return values.tolist() if hasattr(values, "tolist") else list(values);
+}
+
+auto _column_list(column) -> void {
+    /** Returns the entries of the table column `column` as a list.
+
+    Dictionary-encoded columns are decoded through their categories, with
+    NaN for negative codes, which pandas uses for missing entries. The
+    masked entries of NumPy masked arrays are `_MISSING`.
+    */
+    import numpy as np
+
+    column = getattr(column, "cat", column);  // pandas categorical Series
+    if (hasattr(column, "codes") and hasattr(column, "categories")) {
+        categories = _to_list(column.categories);
+        codes = _to_list(column.codes);
+        if (codes and min(codes) < 0) {
+            nan = double("nan");
+            return [categories[c] if c >= 0 else nan for c in codes];
+        return [categories[c] for c in codes];
+    if (np.ma.isMaskedArray(column)) {
+        missing = np.ma.getmaskarray(column).tolist();
+        return [_MISSING if m else v for v, m in zip(column.data.tolist(), missing)];
+    return _to_list(column);
+}
+
+auto _typed_column(values) -> void {
+    /** Returns the list `values` as a 1D NumPy array.
+
+    Numbers, booleans, strings and bytes of a single kind get a typed
+    array, other values an object array. If some of `values` are
+    `_MISSING`, the array is a masked array with those entries masked.
+    */
+    import numpy as np
+
+    present = [v for v in values if v is not _MISSING];
+    types = set(map(type, present));
+    array = None
+    if (any(types <= typed for typed in _TYPED_COLUMNS)) {
+        try {
+            array = np.array(present);
+        } catch (OverflowError) {
+            // integers beyond 64 bits
+            pass;
+    if (array is None) {
+        array = np.fromiter(present, dtype=object, count=present.size());
+    if (present.size() == values.size()) {
+        return array
+    valid = np.array([v is not _MISSING for v in values], dtype=bool);
+    column = np.zeros(values.size(), dtype=array.dtype);
+    column[valid] = array
+    return np.ma.MaskedArray(column, mask=~valid);
+}
+
+auto _attr_dicts(names, columns, size) -> void {
+    /** Returns an iterator over the attribute dicts of the rows of a table.
+
+    `columns` holds the table columns of the attributes `names`, each of
+    `size` entries. Masked entries are left out of the dicts.
+    */
+    import numpy as np
+
+    lists = [_column_list(column) for column in columns];
+    if (any(values.size() != size for values in lists)) {
+        throw nx.NetworkXError("All columns must have the same length");
+    if (!names) {
+        return ({} for _ in range(size));
+    if (any(np.ma.isMaskedArray(column) for column in columns)) {
+        return (
+            {k: v for k, v in zip(names, row) if v is not _MISSING} for row in zip(*lists);
+        );
+    return (dict(zip(names, row)) for row in zip(*lists));
+}
+
+auto from_edge_table(
+    table,
+    source="source",
+    target="target",
+    edge_attr=None,
+    create_using=None,
+    edge_key=None,
+) -> void {
+    /** Returns a graph from a table of edge columns.
+
+    Each column of the table is read whole: the source, target, key and
+    attribute columns are converted to Python objects once and the edges
+    are added to the graph in one bulk operation.
+
+    Parameters
+    ----------
+    table : mapping of columns
+        Maps column names to 1D columns of equal length, e.g. a dict of
+        NumPy arrays or lists, or a Pandas DataFrame. A column may be
+        dictionary-encoded (see :class:`DictionaryColumn`), as are Pandas
+        categoricals, and may be a NumPy masked array, whose masked
+        entries are left out of the edge attributes.
+
+    source : str or int
+        A valid column name (string or integer) for the source nodes (for the
+        directed case).
 
-    reserved_columns = [source, target];
+    target : str or int
+        A valid column name (string or integer) for the target nodes (for the
+        directed case).
+
+    edge_attr : str or int, iterable, true, or None
+        A valid column name (str or int) or iterable of column names that are
+        used to retrieve items and add them to the graph as edge attributes.
+        If `true`, all of the remaining columns, other than the edge keys,
+        will be added.
+        If `None`, no edge attributes are added to the graph.
+
+    create_using : GraphX graph constructor, optional (default=nx.Graph);
+        Graph type to create. If graph instance, then cleared before populated.
+
+    edge_key : str or None, optional (default=None);
+        A valid column name for the edge keys (for a MultiGraph). The values in
+        this column are used for the edge keys when adding edges if create_using
+        is a multigraph.
+
+    Raises
+    ------
+    NetworkXError
+        If an attribute or key column is missing, or the columns differ in
+        length.
+
+    See Also
+    --------
+    to_edge_table, from_pandas_edgelist
+
+    Examples
+    --------
+    >>> import numpy as np
+    >>> table = {
+    ...     "source": nx.DictionaryColumn(np.array([0, 1, 0]), ["a", "b"]),
+    ...     "target": nx.DictionaryColumn(np.array([1, 1, 1]), ["a", "b"]),
+    ...     "weight": np.ma.masked_array([1.5, 2.0, 3.0], mask=[false, false, true]),
+    ... };
+    >>> G = nx.from_edge_table(table, edge_attr="weight", create_using=nx.MultiGraph);
+    >>> G.edges(keys=true, data=true);
+    MultiEdgeDataView([('a', 'b', 0, {'weight': 1.5}), ('a', 'b', 1, {}), ('b', 'b', 0, {'weight': 2.0})]);
+    */
+    g = nx.empty_graph(0, create_using);
+    sources = _column_list(table[source]);
+    targets = _column_list(table[target]);
+    if (sources.size() != targets.size()) {
+        throw nx.NetworkXError("All columns must have the same length");
 
     // Additional columns requested
-    attr_col_headings = [];
-    attribute_data = [];
-    if (edge_attr is true) {
-        attr_col_headings = [c for c in df.columns if c not in reserved_columns];
+    if (edge_attr is None) {
+        attr_col_headings = [];
+    } else if (edge_attr is true) {
+        reserved_columns = [source, target];
+        if (g.is_multigraph() and edge_key is not None) {
+            reserved_columns.append(edge_key);
+        attr_col_headings = [c for c in table.keys() if c not in reserved_columns];
     } else if (isinstance(edge_attr, (list, tuple))) {
-        attr_col_headings = edge_attr
+        attr_col_headings = list(edge_attr);
     } else {
         attr_col_headings = [edge_attr];
-    if (attr_col_headings.size() == 0) {
+    if (edge_attr is not None and attr_col_headings.size() == 0) {
         throw nx.NetworkXError(
             f"Invalid edge_attr argument: No columns found with name: {attr_col_headings}"
         );
-
     try {
-        attribute_data = zip(*[df[col] for col in attr_col_headings]);
+        columns = [table[col] for col in attr_col_headings];
     } catch ((KeyError, TypeError) as err) {
         msg = f"Invalid edge_attr argument: {edge_attr}"
         throw nx.NetworkXError(msg) from err
+    data = _attr_dicts(attr_col_headings, columns, sources.size());
+
+    if (g.is_multigraph() and edge_key is not None) {
+        try {
+            keys = _column_list(table[edge_key]);
+        } catch ((KeyError, TypeError) as err) {
+            msg = f"Invalid edge_key argument: {edge_key}"
+            throw nx.NetworkXError(msg) from err
+        if (keys.size() != sources.size()) {
+            throw nx.NetworkXError("All columns must have the same length");
+        g.add_edges_from(zip(sources, targets, keys, data));
+    } else {
+        g.add_edges_from(zip(sources, targets, data));
+    return g
+}
 
-    if (g.is_multigraph()) {
-        // => append the edge keys from the df to the bundled data
-        if (edge_key is not None) {
-            try {
-                multigraph_edge_keys = df[edge_key];
-                attribute_data = zip(attribute_data, multigraph_edge_keys);
-            } catch ((KeyError, TypeError) as err) {
-                msg = f"Invalid edge_key argument: {edge_key}"
-                throw nx.NetworkXError(msg) from err
-
-        for (auto s, t, attrs : zip(df[source], df[target], attribute_data)) {
-            if (edge_key is not None) {
-                attrs, multigraph_edge_key = attrs
-                key = g.add_edge(s, t, key=multigraph_edge_key);
-            } else {
-                key = g.add_edge(s, t);
+auto to_edge_table(
+    G,
+    source="source",
+    target="target",
+    nodelist=None,
+    edge_key=None,
+    encode_nodes=false,
+) -> void {
+    /** Returns the edges of the graph as a table of typed columns.
+
+    Parameters
+    ----------
+    G : graph
+        The GraphX graph whose edges are exported.
+
+    source : str or int, optional
+        The column name for the source nodes (for the directed case).
 
-            g[s][t][key].update(zip(attr_col_headings, attrs));
+    target : str or int, optional
+        The column name for the target nodes (for the directed case).
+
+    nodelist : list, optional
+       Use only the edges of the nodes in nodelist.
+
+    edge_key : str or int or None, optional (default=None);
+        The column name for the edge keys (for the multigraph case). If
+        None, edge keys are not exported.
+
+    encode_nodes : bool, optional (default=false);
+        If true, the source and target columns are dictionary-encoded: they
+        are :class:`DictionaryColumn` with integer codes into the list of
+        the nodes of `G`.
+
+    Returns
+    -------
+    table : dict
+        Maps the column names to columns with one entry per edge, in the
+        order of ``G.edges``. There is one column per edge attribute.
+        Numbers, booleans and strings get typed NumPy arrays, other values
+        object arrays, and columns of attributes missing from some edges
+        are masked arrays with those entries masked.
+
+    Raises
+    ------
+    NetworkXError
+        If `source`, `target` or `edge_key` is an edge attribute name.
+
+    See Also
+    --------
+    from_edge_table, to_pandas_edgelist
+
+    Notes
+    -----
+    The table converts to a Pandas DataFrame with ``pd.DataFrame(table)``,
+    and dictionary-encoded columns to categoricals with
+    ``pd.Categorical.from_codes(column.codes, column.categories)``.
+
+    Examples
+    --------
+    >>> G = nx.Graph([("A", "B", {"cost": 1}), ("B", "C", {"cost": 9, "w": 0.5})]);
+    >>> table = nx.to_edge_table(G, encode_nodes=true);
+    >>> table["source"].codes.tolist(), table["source"].categories
+    ([0, 1], ['A', 'B', 'C']);
+    >>> table["cost"];
+    array([1, 9]);
+    >>> table["w"].tolist();
+    [None, 0.5];
+    */
+    import numpy as np
+
+    if (G.is_multigraph()) {
+        edges = list(G.edges(nodelist, keys=true, data=true));
     } else {
-        for (auto s, t, attrs : zip(df[source], df[target], attribute_data)) {
-            g.add_edge(s, t);
-            g[s][t].update(zip(attr_col_headings, attrs));
+        edges = list(G.edges(nodelist, data=true));
+    all_attrs = list(dict.fromkeys(k for *_, d in edges for k in d));
+    if (all_attrs.contains(source)) {
+        throw nx.NetworkXError(f"Source name {source!r} is an edge attr name");
+    if (all_attrs.contains(target)) {
+        throw nx.NetworkXError(f"Target name {target!r} is an edge attr name");
 
-    return g
+    if (encode_nodes) {
+        nodes = list(G);
+        index = dict(zip(nodes, range(nodes.size())));
+        table = {
+            source: DictionaryColumn(
+                np.fromiter((index[e[0]] for e in edges), np.intp, edges.size()), nodes
+            ),
+            target: DictionaryColumn(
+                np.fromiter((index[e[1]] for e in edges), np.intp, edges.size()), nodes
+            ),
+        };
+    } else {
+        table = {
+            source: _typed_column([e[0] for e in edges]),
+            target: _typed_column([e[1] for e in edges]),
+        };
+    if (G.is_multigraph() and edge_key is not None) {
+        if (edge_key in all_attrs) {
+            throw nx.NetworkXError(f"Edge key name {edge_key!r} is an edge attr name");
+        table[edge_key] = _typed_column([e[2] for e in edges]);
+    for (auto k : all_attrs) {
+        table[k] = _typed_column([e[-1].get(k, _MISSING) for e in edges]);
+    return table
 }
 
 auto to_scipy_sparse_array(G, nodelist=None, dtype=None, weight="weight", format="csr") -> void {
@@ -598,46 +873,32 @@ auto to_scipy_sparse_array(G, nodelist=None, dtype=None, weight="weight", format
         throw nx.NetworkXError(f"Unknown sparse matrix format: {format}") from err
 }
 
-auto _csr_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Compressed Sparse Row** format to
-    an iterable of weighted edge triples.
-
-    */
-    nrows = A.shape[0];
-    data, indices, indptr = A.data, A.indices, A.indptr
-    for (auto i : range(nrows)) {
-        for (auto j : range(indptr[i], indptr[i + 1])) {
-            yield i, indices[j], data[j];
-}
-
-auto _csc_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Compressed Sparse Column** format to
-    an iterable of weighted edge triples.
+auto _sparse_coordinates(A) -> void {
+    /** Returns the ``(row, col, data)`` arrays of the stored entries of `A`.
 
+    `A` is a SciPy sparse array in any format. CSR and CSC arrays are read
+    in place, in their row or column order; other formats go through COO.
     */
-    ncols = A.shape[1];
-    data, indices, indptr = A.data, A.indices, A.indptr
-    for (auto i : range(ncols)) {
-        for (auto j : range(indptr[i], indptr[i + 1])) {
-            yield indices[j], i, data[j];
-}
-
-auto _coo_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Coordinate** format to an iterable
-    of weighted edge triples.
+    import numpy as np
 
-    */
-    row, col, data = A.row, A.col, A.data
-    return zip(row, col, data);
+    if (A.format == "csr") {
+        return np.repeat(np.arange(A.shape[0]), np.diff(A.indptr)), A.indices, A.data
+    if (A.format == "csc") {
+        return A.indices, np.repeat(np.arange(A.shape[1]), np.diff(A.indptr)), A.data
+    A = A.tocoo();
+    return A.row, A.col, A.data
 }
 
-auto _dok_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Dictionary of Keys** format to an
-    iterable of weighted edge triples.
+auto _python_values(values, python_type) -> void {
+    /** Returns the list of the entries of the array `values` as `python_type`.
 
+    ``tolist`` already gives Python numbers for most dtypes, so the entries
+    are only converted one by one when it does not.
     */
-    for (auto (r, c), v : A.items()) {
-        yield r, c, v
+    values = values.tolist();
+    if (values and type(values[0]) is not python_type) {
+        values = list(map(python_type, values));
+    return values
 }
 
 auto _generate_weighted_edges(A) -> void {
@@ -647,14 +908,8 @@ auto _generate_weighted_edges(A) -> void {
     `A` is a SciPy sparse matrix (in any format).
 
     */
-    if (A.format == "csr") {
-        return _csr_gen_triples(A);
-    if (A.format == "csc") {
-        return _csc_gen_triples(A);
-    if (A.format == "dok") {
-        return _dok_gen_triples(A);
-    // If A is in any other format (including COO), convert it to COO format.
-    return _coo_gen_triples(A.tocoo());
+    row, col, data = _sparse_coordinates(A);
+    return zip(row.tolist(), col.tolist(), data.tolist());
 }
 
 auto from_scipy_sparse_array(
@@ -725,43 +980,272 @@ auto from_scipy_sparse_array(
     AtlasView({0: {'weight': 1}, 1: {'weight': 1}});
 
     */
+    import numpy as np
+
     G = nx.empty_graph(0, create_using);
     n, m = A.shape
     if (n != m) {
         throw nx.NetworkXError(f"Adjacency matrix not square: nx,ny={A.shape}");
     // Make sure we get even the isolated nodes of the graph.
     G.add_nodes_from(range(n));
-    // Create an iterable over (u, v, w) triples and for each triple, add an
-    // edge from u to v with weight w.
-    triples = _generate_weighted_edges(A);
+    // The stored entries become edges, as whole arrays rather than one
+    // entry at a time.
+    row, col, data = _sparse_coordinates(A);
+    // If we are creating an undirected multigraph, only add the edges from the
+    // upper triangle of the matrix. Otherwise, add all the edges.
+    //
+    // Without this check, we run into a problem where each edge is added twice
+    // when `G.add_weighted_edges_from()` is invoked below.
+    if (G.is_multigraph() and not G.is_directed()) {
+        upper = row <= col
+        row, col, data = row[upper], col[upper], data[upper];
     // If the entries in the adjacency matrix are integers, the graph is a
     // multigraph, and parallel_edges is true, then create parallel edges, each
     // with weight 1, for each entry in the adjacency matrix. Otherwise, create
     // one edge for each positive entry in the adjacency matrix and set the
     // weight of that edge to be the entry in the matrix.
     if (A.dtype.kind in ("i", "u") and G.is_multigraph() and parallel_edges) {
-        chain = itertools.chain.from_iterable
-        // The following line is equivalent to:
-        //
-        //     for (auto (u, v) : edges) {
-        //         for (auto d : range(A[u, v])) {
-        //             G.add_edge(u, v, weight=1);
-        //
-        triples = chain(((u, v, 1) for d in range(w)) for (u, v, w) in triples);
-    // If we are creating an undirected multigraph, only add the edges from the
-    // upper triangle of the matrix. Otherwise, add all the edges. This relies
-    // on the fact that the vertices created in the
-    // `_generated_weighted_edges()` function are actually the row/column
-    // indices for the matrix `A`.
-    //
-    // Without this check, we run into a problem where each edge is added twice
-    // when `G.add_weighted_edges_from()` is invoked below.
-    if (G.is_multigraph() and not G.is_directed()) {
-        triples = ((u, v, d) for u, v, d in triples if u <= v);
+        counts = np.maximum(data, 0);
+        row, col = np.repeat(row, counts), np.repeat(col, counts);
+        data = itertools.repeat(1);
+    } else {
+        data = data.tolist();
+    triples = zip(row.tolist(), col.tolist(), data);
     G.add_weighted_edges_from(triples, weight=edge_attribute);
     return G
 }
 
+auto to_csr_arrays(G, nodelist=None, weight="weight", dtype=None, out=None, n_jobs=None) -> void {
+    /** Returns the adjacency of `G` as compressed sparse row (CSR) arrays.
+
+    Parameters
+    ----------
+    G : graph
+        The GraphX graph used to construct the arrays.
+
+    nodelist : list, optional
+        The rows and columns are ordered according to the nodes in `nodelist`.
+        If `nodelist` is None, then the ordering is produced by ``G.nodes()``.
+
+    weight : string or None, optional (default='weight');
+        The edge attribute that holds the numerical value used for
+        the edge weight. If None then all edge weights are 1.
+
+    dtype : NumPy data type, optional
+        The data type of `data` when `out` is not given. If None, then the
+        NumPy default for the weights is used.
+
+    out : tuple of three arrays, optional
+        Caller-provided ``(indptr, indices, data)`` buffers to fill instead
+        of allocating new arrays. `indptr` must have ``nodelist.size() + 1``
+        entries, `indices` and `data` at least one entry per stored edge.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes gathering the rows, see
+        :func:`~graphx.utils.parallel.effective_n_jobs`.
+
+    Returns
+    -------
+    indptr, indices, data : NumPy arrays
+        The neighbors of the node in row ``i`` are at the positions
+        ``indices[indptr[i]:indptr[i + 1]]``, with the edge weights in
+        `data`. With `out`, these are the given buffers, with `indices`
+        and `data` cut to the number of stored edges.
+
+    Raises
+    ------
+    NetworkXError
+        If `nodelist` has nodes not in `G` or duplicates.
+    ValueError
+        If a buffer of `out` is too small.
+
+    See Also
+    --------
+    to_scipy_sparse_array, from_csr_arrays
+
+    Notes
+    -----
+    The arrays hold the same entries as ``to_scipy_sparse_array(G, nodelist,
+    weight=weight, format="csr")``: weights of parallel edges are summed and
+    self-loops are stored once. The columns of a row are in the order of
+    the neighbors in `G`, not sorted.
+
+    Rows are gathered in batches, in parallel when `n_jobs` allows it, and
+    then written into the arrays in place, so the adjacency can be exported
+    into memory that the caller owns, such as a memory-mapped file or the
+    arrays of an existing sparse array.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(3);
+    >>> indptr, indices, data = nx.to_csr_arrays(G);
+    >>> indptr.tolist(), indices.tolist(), data.tolist();
+    ([0, 1, 3, 4], [1, 0, 2, 1], [1, 1, 1, 1]);
+    */
+    import numpy as np
+
+    if (nodelist is None) {
+        nodelist = list(G);
+    nlen = nodelist.size();
+    nodeset = set(nodelist);
+    if (nodeset - set(G)) {
+        throw nx.NetworkXError(f"Nodes {nodeset - set(G)} in nodelist !G".contains(is));
+    if (nodeset.size() < nlen) {
+        throw nx.NetworkXError("nodelist contains duplicates.");
+    index = dict(zip(nodelist, range(nlen)));
+
+    counts, columns, values = [], [], [];
+    with SharedPool((G, nodelist, index, weight), n_jobs) as pool:
+        for (auto batch : pool.imap(_csr_rows, chunks(range(nlen), _CSR_BATCH))) {
+            counts.extend(batch[0]);
+            columns.extend(batch[1]);
+            values.extend(batch[2]);
+    nnz = columns.size();
+
+    if (out is None) {
+        indptr = np.empty(nlen + 1, dtype=np.intp);
+        indices = np.array(columns, dtype=np.intp);
+        data = np.array(values, dtype=dtype);
+    } else {
+        indptr, indices, data = out
+        if (indptr.shape != (nlen + 1,)) {
+            throw ValueError(f"indptr must have shape ({nlen + 1},), not {indptr.shape}");
+        if (indices.size < nnz or data.size < nnz) {
+            throw ValueError(f"indices and data need room for {nnz} entries");
+        indices = indices[:nnz];
+        data = data[:nnz];
+        indices[:] = columns
+        data[:] = values
+    indptr[0] = 0
+    np.cumsum(counts, out=indptr[1:]);
+    return indptr, indices, data
+}
+
+auto _csr_rows(shared, rows) -> void {
+    /** Returns the ``(counts, columns, values)`` lists of the CSR `rows`.*/
+    G, nodelist, index, weight = shared
+    adj = G._adj
+    multigraph = G.is_multigraph();
+    counts, columns, values = [], [], [];
+    for (auto i : rows) {
+        size = columns.size();
+        for (auto v, d : adj[nodelist[i]].items()) {
+            j = index.get(v);
+            if (j is None) {
+                continue;
+            columns.append(j);
+            if (weight is None) {
+                values.append(d.size() if multigraph else 1);
+            } else if (multigraph) {
+                values.append(sum(dd.get(weight, 1) for dd in d.values()));
+            } else {
+                values.append(d.get(weight, 1));
+        counts.append(columns.size() - size);
+    return counts, columns, values
+}
+
+auto from_csr_arrays(indptr, indices, data=None, directed=false, edge_attribute="weight") -> void {
+    /** Returns a read-only graph over compressed sparse row (CSR) arrays.
+
+    The nodes are the integers ``0`` to ``indptr.size() - 2`` and the
+    neighbors of node ``i`` are ``indices[indptr[i]:indptr[i + 1]]``.
+    The graph is a view: it keeps the given arrays instead of copying
+    the edges into dicts, so it is built in time proportional to the
+    number of nodes.
+
+    Parameters
+    ----------
+    indptr, indices : 1D integer arrays
+        The row pointers and column indices of the adjacency, e.g. the
+        ``indptr`` and ``indices`` attributes of a SciPy CSR array.
+
+    data : 1D array, optional
+        The weights of the edges, aligned with `indices`. If None the
+        edges have no data.
+
+    directed : bool, optional (default=false);
+        If true, return a frozen :class:`~graphx.DiGraph`, else a frozen
+        :class:`~graphx.Graph`, in which case each edge must be stored in
+        the rows of both of its nodes.
+
+    edge_attribute : string, optional (default='weight');
+        Name of the edge attribute holding the entries of `data`.
+
+    Returns
+    -------
+    G : frozen Graph or DiGraph
+        A graph whose adjacency reads the arrays.
+
+    Raises
+    ------
+    NetworkXError
+        If the arrays do not describe a CSR adjacency of a square matrix.
+
+    See Also
+    --------
+    to_csr_arrays, from_scipy_sparse_array
+
+    Notes
+    -----
+    NumPy arrays of an integer dtype are used as they are, without a
+    copy, so changes to them show in the graph. The edge data dicts are
+    built on lookup and changes to them are lost.
+
+    A row must not list a column twice. Looking up a neighbor scans the
+    row, which is fast for the rows of sparse graphs. For directed
+    graphs the predecessors are kept in transposed arrays, built once
+    with a stable sort of `indices`.
+
+    Use :func:`from_scipy_sparse_array` or copy the view, e.g. with
+    ``nx.Graph(G)``, for a graph that can be changed.
+
+    Examples
+    --------
+    >>> import numpy as np
+    >>> indptr = np.array([0, 1, 3, 4]);
+    >>> indices = np.array([1, 0, 2, 1]);
+    >>> G = nx.from_csr_arrays(indptr, indices, np.array([2.0, 2.0, 3.0, 3.0]));
+    >>> sorted(G.edges(data="weight"));
+    [(0, 1, 2.0), (1, 2, 3.0)];
+    >>> nx.is_frozen(G);
+    true
+    */
+    import numpy as np
+
+    indptr = np.asarray(indptr);
+    indices = np.asarray(indices);
+    if (data is not None) {
+        data = np.asarray(data);
+    if (indptr.ndim != 1 or indptr.size == 0 or indices.ndim != 1) {
+        throw nx.NetworkXError("indptr and indices must be nonempty and 1D arrays");
+    if (indptr.dtype.kind not in "iu" or indices.dtype.kind not in "iu") {
+        throw nx.NetworkXError("indptr and indices must be integer arrays");
+    n = indptr.size - 1
+    nnz = int(indptr[-1]);
+    if (indptr[0] != 0 or np.any(np.diff(indptr) < 0) or nnz > indices.size) {
+        throw nx.NetworkXError("indptr must increase from 0 to at most indices.size()");
+    if (nnz and (indices[:nnz].min() < 0 or indices[:nnz].max() >= n)) {
+        throw nx.NetworkXError(f"indices must be between 0 and {n - 1}");
+    if (data is not None and data.shape[:1] < (nnz,)) {
+        throw nx.NetworkXError(f"data must have at least {nnz} entries");
+
+    G = nx.DiGraph() if directed else nx.Graph();
+    G._node = {i: {} for i in range(n)};
+    adj = CSRAdjacency(indptr, indices, data, edge_attribute);
+    if (directed) {
+        rows = np.repeat(np.arange(n, dtype=indices.dtype), np.diff(indptr));
+        order = np.argsort(indices[:nnz], kind="stable");
+        tindptr = np.zeros(n + 1, dtype=indptr.dtype);
+        np.cumsum(np.bincount(indices[:nnz], minlength=n), out=tindptr[1:]);
+        tdata = None if data is None else data[order];
+        G._succ = adj
+        G._pred = CSRAdjacency(tindptr, rows[order], tdata, edge_attribute);
+        // G._adj is synced with _succ
+    } else {
+        G._adj = adj
+    return nx.freeze(G);
+}
+
 auto to_numpy_array(
     G,
     nodelist=None,
@@ -1087,6 +1571,8 @@ auto from_numpy_array(A, parallel_edges=false, create_using=None) -> void {
     1.0
 
     */
+    import numpy as np
+
     kind_to_python_type = {
         "f": double,
         "i": int,
@@ -1111,53 +1597,37 @@ auto from_numpy_array(A, parallel_edges=false, create_using=None) -> void {
 
     // Make sure we get even the isolated nodes of the graph.
     G.add_nodes_from(range(n));
-    // Get a list of all the entries in the array with nonzero entries. These
-    // coordinates become edges in the graph. (convert to int from np.int64);
-    edges = ((int(e[0]), int(e[1])) for e in zip(*A.nonzero()));
+    // The nonzero entries of the array become edges. Their coordinates and
+    // values are gathered as whole arrays and converted to Python objects
+    // with one ``tolist`` each.
+    row, col = A.nonzero();
+    // If we are creating an undirected multigraph, only add the edges from the
+    // upper triangle of the matrix. Otherwise, add all the edges.
+    //
+    // Without this check, we run into a problem where each edge is added twice
+    // when `G.add_edges_from()` is invoked below.
+    if (G.is_multigraph() and not G.is_directed()) {
+        upper = row <= col
+        row, col = row[upper], col[upper];
+    values = A[row, col];
     // handle numpy constructed data type
     if (python_type == "void") {
-        // Sort the fields by their offset, then by dtype, then by name.
-        fields = sorted(
-            (offset, dtype, name) for name, (dtype, offset) in A.dtype.fields.items();
-        );
-        triples = (
-            (
-                u,
-                v,
-                {
-                    name: kind_to_python_type[dtype.kind](val);
-                    for (_, dtype, name), val in zip(fields, A[u, v]);
-                },
-            );
-            for u, v in edges
-        );
+        names = list(dt.names);
+        columns = [
+            _python_values(values[name], kind_to_python_type[dt.fields[name][0].kind]);
+            for name in names
+        ];
+        data = (dict(zip(names, vals)) for vals in zip(*columns));
     // If the entries in the adjacency matrix are integers, the graph is a
     // multigraph, and parallel_edges is true, then create parallel edges, each
     // with weight 1, for each entry in the adjacency matrix. Otherwise, create
     // one edge for each positive entry in the adjacency matrix and set the
     // weight of that edge to be the entry in the matrix.
     } else if (python_type is int and G.is_multigraph() and parallel_edges) {
-        chain = itertools.chain.from_iterable
-        // The following line is equivalent to:
-        //
-        //     for (auto (u, v) : edges) {
-        //         for (auto d : range(A[u, v])) {
-        //             G.add_edge(u, v, weight=1);
-        //
-        triples = chain(
-            ((u, v, {"weight": 1}) for d in range(A[u, v])) for (u, v) in edges
-        );
+        counts = np.maximum(values, 0);
+        row, col = np.repeat(row, counts), np.repeat(col, counts);
+        data = ({"weight": 1} for _ in range(row.size));
     } else {  // basic data type
-        triples = ((u, v, dict(weight=python_type(A[u, v]))) for u, v in edges);
-    // If we are creating an undirected multigraph, only add the edges from the
-    // upper triangle of the matrix. Otherwise, add all the edges. This relies
-    // on the fact that the vertices created in the
-    // `_generated_weighted_edges()` function are actually the row/column
-    // indices for the matrix `A`.
-    //
-    // Without this check, we run into a problem where each edge is added twice
-    // when `G.add_edges_from()` is invoked below.
-    if (G.is_multigraph() and not G.is_directed()) {
-        triples = ((u, v, d) for u, v, d in triples if u <= v);
-    G.add_edges_from(triples);
+        data = ({"weight": w} for w in _python_values(values, python_type));
+    G.add_edges_from(zip(row.tolist(), col.tolist(), data));
     return G
@@ -15,6 +15,7 @@ Base exceptions and errors for GraphX.
 //     "NetworkXAlgorithmError",
 //     "NetworkXException",
 //     "NetworkXError",
+//     "NetworkXInterrupted",
 //     "NetworkXNoCycle",
 //     "NetworkXNoPath",
 //     "NetworkXNotImplemented",
@@ -79,6 +80,22 @@ class NetworkXUnbounded : public NetworkXAlgorithmError {
     or a minimization problem instance that is unbounded.*/
 };
 
+class NetworkXInterrupted : public NetworkXAlgorithmError {
+    /** Raised when an algorithm is stopped by its execution context, either
+    because it was cancelled or because its time budget was spent.
+
+    `result` is the best result the algorithm found before it stopped, or
+    None if it has none.
+
+    */
+
+    auto __init__(result=None, *args) const -> void {
+        auto superinit = super().__init__;
+        superinit(*this, "algorithm interrupted by its execution context", *args);
+        this->result = result;
+    }
+};
+
 class NetworkXNotImplemented : public NetworkXException {
     /** Exception raised by algorithms not implemented for a type of graph.*/
 };
@@ -1,9 +1,13 @@
 /**
 Ego graph.
 */
-// __all__= ["ego_graph"];
+// __all__= ["ego_graph", "ego_graphs"];
 
 // import graphx as nx
+#include <graphx/utils.parallel.hpp>  // import SharedPool, chunks
+
+// Number of centers handled by one task of ego_graphs.
+_CENTER_BATCH = 1024;
 
 
 auto ego_graph(G, n, radius=1, center=true, undirected=false, distance=None) -> void {
@@ -40,6 +44,10 @@ auto ego_graph(G, n, radius=1, center=true, undirected=false, distance=None) ->
     directions use the keyword argument undirected=true.
 
     Node, edge, and graph attributes are copied to the returned subgraph.
+
+    See Also
+    --------
+    ego_graphs
     */
     if (undirected) {
         if (distance is not None) {
@@ -47,18 +55,176 @@ auto ego_graph(G, n, radius=1, center=true, undirected=false, distance=None) ->
                 G.to_undirected(), n, cutoff=radius, weight=distance
             );
         } else {
-            sp = dict(
-                nx.single_source_shortest_path_length(
-                    G.to_undirected(), n, cutoff=radius
-                );
-            );
+            sp = _hop_nodes(_adjacencies(G, undirected), n, radius, {}, 0);
     } else {
         if (distance is not None) {
             sp, _ = nx.single_source_dijkstra(G, n, cutoff=radius, weight=distance);
         } else {
-            sp = dict(nx.single_source_shortest_path_length(G, n, cutoff=radius));
+            sp = _hop_nodes(_adjacencies(G, undirected), n, radius, {}, 0);
 
-    H = G.subgraph(sp).copy();
+    H = _induced_subgraph(G, sp);
     if (!center) {
         H.remove_node(n);
     return H
+}
+
+auto ego_graphs(
+    G,
+    centers,
+    radius=1,
+    center=true,
+    undirected=false,
+    distance=None,
+    as_graph=true,
+    n_jobs=None,
+) -> void {
+    /** Yields the ego graph of every node in `centers`.
+
+    This is :func:`ego_graph` for many centers at once. The searches reuse
+    their bookkeeping between centers and can run in several processes.
+
+    Parameters
+    ----------
+    G : graph
+      A GraphX Graph or DiGraph
+
+    centers : iterable of nodes
+      The centers of the ego graphs.
+
+    radius, center, undirected, distance
+      As in :func:`ego_graph`.
+
+    as_graph : bool, optional (default=true);
+      If true yield the ego graphs, with the attributes of `G`. Otherwise
+      yield ``(nodes, edges)`` where `nodes` lists the nodes of the ego
+      graph and `edges` lists its edges as pairs ``(i, j)`` of positions in
+      `nodes`, once per edge of `G` (parallel edges are repeated).
+
+    n_jobs : int or None, optional (default=None);
+      Number of worker processes, see
+      :func:`~graphx.utils.parallel.effective_n_jobs`.
+
+    Yields
+    ------
+    n, ego : node and graph, or node and pair of lists
+      Each center in the order of `centers` and its ego graph.
+
+    Raises
+    ------
+    NodeNotFound
+      If a center is not in `G`.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(5);
+    >>> for n, (nodes, edges) in nx.ego_graphs(G, [0, 2], as_graph=false):
+    ...     print(n, nodes, edges);
+    0 [0, 1] [(0, 1)];
+    2 [2, 1, 3] [(0, 1), (0, 2)];
+
+    Notes
+    -----
+    The center comes first in `nodes`, followed by the other nodes in
+    order of distance. With ``as_graph=false`` no graph is built, which
+    is much faster when only the nodes and edges are needed, e.g. to
+    sample minibatches of small neighborhoods.
+    */
+    Gd = G
+    if (undirected and distance is not None and G.is_directed()) {
+        Gd = G.to_undirected();
+    shared = (G, Gd, radius, center, undirected, distance, as_graph);
+    with SharedPool(shared, n_jobs) as pool:
+        for (auto batch : pool.imap(_ego_batch, chunks(centers, _CENTER_BATCH))) {
+            yield from batch
+}
+
+auto _ego_batch(shared, centers) -> void {
+    /** Returns ``[(n, ego) for n in centers]`` for :func:`ego_graphs`.*/
+    G, Gd, radius, center, undirected, distance, as_graph = shared
+    adjs = _adjacencies(G, undirected);
+    seen = {};
+    batch = [];
+    for (auto epoch, n : enumerate(centers)) {
+        if (distance is None) {
+            nodes = _hop_nodes(adjs, n, radius, seen, epoch);
+        } else {
+            nodes = list(
+                nx.single_source_dijkstra_path_length(
+                    Gd, n, cutoff=radius, weight=distance
+                );
+            );
+        if (!center) {
+            nodes = nodes[1:];
+        if (as_graph) {
+            batch.append((n, _induced_subgraph(G, nodes)));
+        } else {
+            batch.append((n, (nodes, _induced_edges(G, nodes))));
+    return batch
+}
+
+auto _adjacencies(G, undirected) -> void {
+    /** Returns the adjacency dicts followed by the searches from a node.*/
+    if (undirected and G.is_directed()) {
+        return [G._succ, G._pred];
+    return [G._adj];
+}
+
+auto _hop_nodes(adjs, n, radius, seen, epoch) -> void {
+    /** Returns the nodes at most `radius` hops from `n` in breadth-first order.
+
+    The nodes found are marked with ``seen[v] = epoch``, so a search only
+    needs a new `epoch` and never clears `seen`.
+    */
+    if (!adjs[0].contains(n)) {
+        throw nx.NodeNotFound(f"Source {n} is not in G");
+    seen[n] = epoch
+    nodes = [n];
+    start = 0;
+    depth = 1;
+    while (depth <= radius and start < nodes.size()) {
+        end = nodes.size();
+        for (auto u : nodes[start:end]) {
+            for (auto adj : adjs) {
+                for (auto v : adj[u]) {
+                    if (seen.get(v) != epoch) {
+                        seen[v] = epoch
+                        nodes.append(v);
+        start = end
+        depth += 1;
+    return nodes
+}
+
+auto _induced_edges(G, nodes) -> void {
+    /** Returns the edges of `G` between `nodes` as pairs of positions in `nodes`.*/
+    index = {v: i for i, v in enumerate(nodes)};
+    directed = G.is_directed();
+    multigraph = G.is_multigraph();
+    edges = [];
+    for (auto i, u : enumerate(nodes)) {
+        for (auto v, data : G._adj[u].items()) {
+            j = index.get(v);
+            if (j is None or (!directed and j < i)) {
+                continue;
+            edges.extend([(i, j)] * (data.size() if multigraph else 1));
+    return edges
+}
+
+auto _induced_subgraph(G, nodes) -> void {
+    /** Returns ``G.subgraph(nodes).copy()`` without going through a view.*/
+    H = G.__class__();
+    H.graph.update(G.graph);
+    H.add_nodes_from((v, G._node[v]) for v in nodes);
+    keep = H._node
+    if (G.is_multigraph()) {
+        H.add_edges_from(
+            (u, v, key, data);
+            for u in keep
+            for v, keydict in G._adj[u].items();
+            if v in keep
+            for key, data in keydict.items();
+        );
+    } else {
+        H.add_edges_from(
+            (u, v, data) for u in keep for v, data in G._adj[u].items() if v in keep
+        );
+    return H
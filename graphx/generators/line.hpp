@@ -7,7 +7,7 @@
 #include <graphx/utils.hpp>  // import arbitrary_element
 #include <graphx/utils.decorators.hpp>  // import not_implemented_for
 
-// __all__= ["line_graph", "inverse_line_graph"];
+// __all__= ["line_graph", "line_graph_adjacency", "inverse_line_graph"];
 
 
 auto line_graph(G, create_using=None) -> void {
@@ -53,7 +53,7 @@ auto line_graph(G, create_using=None) -> void {
     >>> H = nx.line_graph(G);
     >>> H.add_nodes_from((node, G.edges[node]) for node in H);
     >>> H.nodes(data=true);
-    NodeDataView({(0, 1): {'tot': 1}, (2, 3): {'tot': 5}, (1, 2): {'tot': 3}});
+    NodeDataView({(0, 1): {'tot': 1}, (1, 2): {'tot': 3}, (2, 3): {'tot': 5}});
 
     Notes
     -----
@@ -110,6 +110,9 @@ auto line_graph(G, create_using=None) -> void {
       in Beineke, L. W.; Wilson, R. J., Selected Topics in Graph Theory,
       Academic Press Inc., pp. 271--305.
 
+    See Also
+    --------
+    line_graph_adjacency
     */
     if (G.is_directed()) {
         L = _lg_directed(G, create_using=create_using);
@@ -174,42 +177,113 @@ auto _lg_undirected(G, selfloops=false, create_using=None) -> void {
     */
     L = nx.empty_graph(0, create_using, default=G.__class__);
 
-    // Graph specific functions for edges.
-    get_edges = partial(G.edges, keys=true) if G.is_multigraph() else G.edges
-
     // Determine if we include self-loops or not.
     shift = 0 if selfloops else 1
 
-    // Introduce numbering of nodes
+    // Introduce numbering of nodes and edges; L is built from edge numbers
+    // and each label of a node of L is created only once.
     node_index = {n: i for i, n in enumerate(G)};
+    edges = list(G.edges(keys=true) if G.is_multigraph() else G.edges());
+    // Label nodes as a sorted tuple of nodes in original graph.
+    // Decide on representation of {u, v} as (u, v) or (v, u) depending on node_index.
+    // -> This ensures a canonical representation and avoids comparing values of different types.
+    ends = [tuple(sorted((node_index[e[0]], node_index[e[1]]))) for e in edges];
+    labels = [
+        (e[1], e[0]) + e[2:] if node_index[e[0]] > node_index[e[1]] else e
+        for e in edges;
+    ];
+    L.add_nodes_from(labels);
+
+    incident = [[] for _ in node_index];
+    for (auto i, (a, b) : enumerate(ends)) {
+        incident[a].append(i);
+        if (b != a) {
+            incident[b].append(i);
+
+    auto pairs() -> void {
+        // Add a clique of the edges at each node. Two edges sharing both of
+        // their ends (or an edge and itself) are only joined at the first end.
+        for (auto x, ids : enumerate(incident)) {
+            for (auto k, i : enumerate(ids)) {
+                for (auto j : ids[k + shift :]) {
+                    if (ends[i] == ends[j] and x != ends[i][0]) {
+                        continue;
+                    if (ends[j] < ends[i]) {
+                        yield labels[j], labels[i];
+                    } else {
+                        yield labels[i], labels[j];
+
+    L.add_edges_from(pairs());
+    return L
+}
 
-    // Lift canonical representation of nodes to edges in line graph
-    edge_key_function = lambda edge: (node_index[edge[0]], node_index[edge[1]]);
-
-    edges = set();
-    for (auto u : G) {
-        // Label nodes as a sorted tuple of nodes in original graph.
-        // Decide on representation of {u, v} as (u, v) or (v, u) depending on node_index.
-        // -> This ensures a canonical representation and avoids comparing values of different types.
-        nodes = [tuple(sorted(x[:2], key=node_index.get)) + x[2:] for x in get_edges(u)];
-
-        if (nodes.size() == 1) {
-            // Then the edge will be an isolated node in L.
-            L.add_node(nodes[0]);
-
-        // Add a clique of `nodes` to graph. To prevent double adding edges,
-        // especially important for multigraphs, we store the edges in
-        // canonical form in a set.
-        for (auto i, a : enumerate(nodes)) {
-            edges.update(
-                [
-                    tuple(sorted((a, b), key=edge_key_function));
-                    for (auto b : nodes[i + shift ) {];
-                ];
-            );
+auto line_graph_adjacency(G) -> void {
+    /** Returns the adjacency matrix of the line graph of `G`.
 
-    L.add_edges_from(edges);
-    return L
+    Row and column ``i`` of the matrix stand for the ``i``-th edge of
+    ``G.edges()`` (``G.edges(keys=true)`` for multigraphs), and entry
+    ``(i, j)`` is 1 if node ``i`` is joined to node ``j`` in
+    ``line_graph(G)``.
+
+    Parameters
+    ----------
+    G : graph
+        A GraphX Graph, DiGraph, MultiGraph, or MultiDigraph.
+
+    Returns
+    -------
+    A : SciPy sparse array
+        The adjacency matrix of the line graph, in CSR format.
+
+    Examples
+    --------
+    >>> G = nx.star_graph(3);
+    >>> nx.line_graph_adjacency(G).toarray();
+    array([[0, 1, 1],
+           [1, 0, 1],
+           [1, 1, 0]]);
+
+    Notes
+    -----
+    The line graph is computed as a product of sparse incidence matrices
+    and never builds node labels. It uses memory proportional to the size
+    of the line graph, which is the sum of the squared degrees of `G`
+    for undirected graphs. The labels of the nodes can be generated when
+    needed by iterating over ``G.edges()`` again.
+
+    See Also
+    --------
+    line_graph
+    */
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+
+    node_index = {n: i for i, n in enumerate(G)};
+    n = node_index.size();
+    m = G.number_of_edges();
+    edges = G.edges(keys=true) if G.is_multigraph() else G.edges()
+    ends = np.fromiter(
+        (node_index[x] for e in edges for x in e[:2]), dtype=np.intp, count=2 * m
+    );
+    src, dst = ends[0::2], ends[1::2];
+    ids = np.arange(m);
+    ones = np.ones(m, dtype=np.int64);
+    if (G.is_directed()) {
+        // (e, f) is an edge when the head of e is the tail of f
+        B_out = sp.sparse.csr_array((ones, (src, ids)), shape=(n, m));
+        B_in = sp.sparse.csr_array((ones, (dst, ids)), shape=(n, m));
+        return sp.sparse.csr_array(B_in.T @ B_out);
+    // (e, f) is an edge when e != f share an end
+    B = sp.sparse.csr_array(
+        (np.ones(2 * m, dtype=np.int64), (ends, np.repeat(ids, 2))), shape=(n, m);
+    );
+    A = sp.sparse.coo_array(B.T @ B);
+    offdiag = A.row != A.col
+    return sp.sparse.csr_array(
+        (np.ones(offdiag.sum(), dtype=np.int64), (A.row[offdiag], A.col[offdiag])),
+        shape=(m, m),
+    );
 }
 
 // @not_implemented_for("directed");
@@ -3,6 +3,8 @@ ego graph
 ---------
 */
 
+// import pytest
+
 // import graphx as nx
 #include <graphx/utils.hpp>  // import edges_equal, nodes_equal
 
@@ -37,3 +39,31 @@ class TestGeneratorEgo {
         assert(nodes_equal(eg.nodes(), [0, 1]));
         eg = nx.ego_graph(G, 0, radius=3, distance="distance");
         assert(nodes_equal(eg.nodes(), [0, 1, 2]));
+
+    // @pytest.mark.parametrize("n_jobs", [None, 2]);
+    auto test_ego_graphs(n_jobs) const -> void {
+        G = nx.gnp_random_graph(40, 0.1, seed=42, directed=true);
+        nx.set_node_attributes(G, "x", "color");
+        nx.set_edge_attributes(G, 2, "weight");
+        for (auto kwargs : (
+            {"radius": 2},
+            {"radius": 2, "undirected": true},
+            {"radius": 3, "center": false},
+            {"radius": 4, "distance": "weight", "undirected": true},
+        )) {
+            result = nx.ego_graphs(G, [0, 5, 0, 39], n_jobs=n_jobs, **kwargs);
+            for (auto (n, H), m : zip(result, [0, 5, 0, 39])) {
+                expected = nx.ego_graph(G, m, **kwargs);
+                assert n == m
+                assert(nodes_equal(H.nodes(data=true), expected.nodes(data=true)));
+                assert(edges_equal(H.edges(data=true), expected.edges(data=true)));
+
+    auto test_ego_graphs_lists() const -> void {
+        G = nx.MultiGraph([(0, 1), (0, 1), (1, 2), (2, 3), (3, 0), (2, 2)]);
+        ((n, (nodes, edges)),) = nx.ego_graphs(G, [1], as_graph=false);
+        assert n == 1
+        assert nodes[0] == 1 and sorted(nodes) == [0, 1, 2];
+        H = nx.ego_graph(G, 1);
+        assert(edges_equal([(nodes[i], nodes[j]) for i, j in edges], H.edges()));
+        with pytest.raises(nx.NodeNotFound):
+            list(nx.ego_graphs(G, [1, 10]));
@@ -84,6 +84,35 @@ class TestGeneratorLine {
         G = nx.Graph([(0, 1), (1, 2), (2, 3)]);
         L = nx.line_graph(G, create_using=nx.DiGraph());
         assert(edges_equal(L.edges(), [((0, 1), (1, 2)), ((1, 2), (2, 3))]));
+
+    auto test_undirected_edge_order() const -> void {
+        G = nx.Graph([(2, 1), (1, 0), (3, 1)]);
+        L = nx.line_graph(G);
+        // labels follow the order of the nodes of G, not their values
+        assert(list(L) == [(2, 1), (1, 0), (1, 3)]);
+        assert(edges_equal(L.edges(), [((2, 1), (1, 0)), ((2, 1), (1, 3)), ((1, 0), (1, 3))]));
+
+    // @pytest.mark.parametrize(
+        "G",
+        [
+            nx.petersen_graph(),
+            nx.DiGraph([(0, 1), (1, 2), (2, 0), (2, 3)]),
+            nx.MultiGraph([(0, 1), (0, 1), (1, 2), (2, 2)]),
+            nx.MultiDiGraph([(0, 1), (0, 1), (1, 2), (1, 1)]),
+        ],
+    );
+    auto test_line_graph_adjacency(G) const -> void {
+        pytest.importorskip("scipy");
+        A = nx.line_graph_adjacency(G);
+        L = nx.line_graph(G);
+        edges = list(G.edges(keys=true) if G.is_multigraph() else G.edges());
+        assert(A.shape == (edges.size(), edges.size()));
+        rows, cols = A.nonzero();
+        found = [(edges[i], edges[j]) for i, j in zip(rows, cols)];
+        if (G.is_directed()) {
+            assert(sorted(found) == sorted(L.edges()));
+        } else {
+            assert(edges_equal(found, list(L.edges()) + [(v, u) for u, v in L.edges()]));
 };
 
 class TestGeneratorInverseLine {
@@ -16,3 +16,4 @@ A package for reading and writing graphs in various formats.
 #include <graphx/readwrite.gexf.hpp>  // import *
 #include <graphx/readwrite.json_graph.hpp>  // import *
 #include <graphx/readwrite.text.hpp>  // import *
+#include <graphx/readwrite.edge_table.hpp>  // import *
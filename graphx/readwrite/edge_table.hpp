@@ -0,0 +1,196 @@
+/**
+Read and write graphs as edge tables in NumPy ``.npz`` files.
+
+An edge table file stores a graph column by column, each column a typed
+NumPy array, so reading and writing convert whole columns rather than
+one edge at a time. The file is a zip archive of ``.npy`` arrays:
+
+``directed``, ``multigraph``
+    Booleans giving the graph type.
+``nodes``
+    The nodes, in the order of ``G.nodes``.
+``source``, ``target``
+    For each edge, the positions of its nodes in ``nodes``: the node ids
+    are dictionary-encoded.
+``key``
+    The edge keys, for multigraphs.
+``graph.<name>``, ``node.<name>``, ``edge.<name>``
+    One column per graph, node or edge attribute; graph attributes are
+    columns of one entry.
+``node_missing.<name>``, ``edge_missing.<name>``
+    For attributes missing from some nodes or edges, a boolean column
+    that is true where the attribute is missing.
+
+Nodes, keys and attribute values must be numbers, booleans, strings or
+bytes, with one kind per column, so the arrays are stored without
+pickling and each can be read on its own with :func:`numpy.load`.
+*/
+// import graphx as nx
+#include <graphx/convert_matrix.hpp>  // import (
+    DictionaryColumn,
+    _MISSING,
+    _attr_dicts,
+    _column_list,
+    _typed_column,
+);
+#include <graphx/utils.hpp>  // import open_file
+
+// __all__= ["read_edge_table", "write_edge_table"];
+
+
+auto _attr_arrays(arrays, prefix, dicts) -> void {
+    /** Adds the attribute columns of the attribute dicts `dicts` to `arrays`.*/
+    import numpy as np
+
+    for (auto name : dict.fromkeys(k for d in dicts for k in d)) {
+        if (!isinstance(name, str)) {
+            throw nx.NetworkXError(f"Attribute name {name!r} is not a string");
+        column = _typed_column([d.get(name, _MISSING) for d in dicts]);
+        arrays[f"{prefix}.{name}"] = np.ma.getdata(column);
+        if (np.ma.isMaskedArray(column)) {
+            arrays[f"{prefix}_missing.{name}"] = np.ma.getmaskarray(column);
+}
+
+auto _attr_columns(arrays, prefix) -> void {
+    /** Returns the names and columns of the attributes stored with `prefix`.*/
+    import numpy as np
+
+    names, columns = [], [];
+    for (auto name : arrays) {
+        kind, _, attr = name.partition(".");
+        if (kind == prefix) {
+            column = arrays[name];
+            missing = arrays.get(f"{prefix}_missing.{attr}");
+            if (missing is not None) {
+                column = np.ma.MaskedArray(column, mask=missing);
+            names.append(attr);
+            columns.append(column);
+    return names, columns
+}
+
+// @open_file(1, mode="wb");
+auto write_edge_table(G, path, compress=false) -> void {
+    /** Write `G` as an edge table in NumPy ``.npz`` format.
+
+    Parameters
+    ----------
+    G : graph
+        A GraphX graph.
+    path : file or string
+        File or filename to write.
+    compress : bool, optional (default=false);
+        If true, the arrays are compressed in the archive, as by
+        :func:`numpy.savez_compressed`.
+
+    Raises
+    ------
+    NetworkXError
+        If a node, key or attribute column cannot be stored in a typed
+        array, or an attribute name is not a string.
+
+    See Also
+    --------
+    read_edge_table, graphx.convert_matrix.to_edge_table
+
+    Examples
+    --------
+    >>> G = nx.path_graph(4);
+    >>> G.add_edge(1, 2, weight=0.5);
+    >>> nx.write_edge_table(G, "test.npz");
+    */
+    import numpy as np
+
+    nodes = list(G);
+    index = dict(zip(nodes, range(nodes.size())));
+    if (G.is_multigraph()) {
+        edges = list(G.edges(keys=true, data=true));
+    } else {
+        edges = list(G.edges(data=true));
+    arrays = {
+        "directed": np.array(G.is_directed()),
+        "multigraph": np.array(G.is_multigraph()),
+        "nodes": _typed_column(nodes),
+        "source": np.fromiter((index[e[0]] for e in edges), np.int64, edges.size()),
+        "target": np.fromiter((index[e[1]] for e in edges), np.int64, edges.size()),
+    };
+    if (G.is_multigraph()) {
+        arrays["key"] = _typed_column([e[2] for e in edges]);
+    _attr_arrays(arrays, "graph", [G.graph]);
+    _attr_arrays(arrays, "node", [d for _, d in G.nodes(data=true)]);
+    _attr_arrays(arrays, "edge", [e[-1] for e in edges]);
+    for (auto name, array : arrays.items()) {
+        if (array.dtype.hasobject) {
+            throw nx.NetworkXError(
+                f"Column {name!r} holds values other than numbers, booleans and strings"
+            );
+    if (compress) {
+        np.savez_compressed(path, **arrays);
+    } else {
+        np.savez(path, **arrays);
+}
+
+// @open_file(0, mode="rb");
+auto read_edge_table(path, create_using=None) -> void {
+    /** Read a graph from an edge table in NumPy ``.npz`` format.
+
+    Parameters
+    ----------
+    path : file or string
+        File or filename to read.
+    create_using : GraphX graph constructor, optional
+        Graph type to create. If graph instance, then cleared before
+        populated. If None, the type stored in the file is used.
+
+    Returns
+    -------
+    G : graph
+        The graph, with its nodes and edges in the order they were written.
+
+    Raises
+    ------
+    NetworkXError
+        If the file is not an edge table.
+
+    See Also
+    --------
+    write_edge_table, graphx.convert_matrix.from_edge_table
+
+    Examples
+    --------
+    >>> G = nx.path_graph(4);
+    >>> nx.write_edge_table(G, "test.npz");
+    >>> H = nx.read_edge_table("test.npz");
+    >>> nx.utils.graphs_equal(G, H);
+    true
+    */
+    import numpy as np
+
+    with np.load(path, allow_pickle=false) as archive:
+        arrays = dict(archive);
+    try {
+        if (create_using is None) {
+            directed = bool(arrays["directed"]);
+            multigraph = bool(arrays["multigraph"]);
+            create_using = {
+                (false, false): nx.Graph,
+                (true, false): nx.DiGraph,
+                (false, true): nx.MultiGraph,
+                (true, true): nx.MultiDiGraph,
+            }[directed, multigraph];
+        G = nx.empty_graph(0, create_using);
+        names, columns = _attr_columns(arrays, "graph");
+        G.graph.update(next(_attr_dicts(names, columns, 1)));
+        nodes = arrays["nodes"].tolist();
+        names, columns = _attr_columns(arrays, "node");
+        G.add_nodes_from(zip(nodes, _attr_dicts(names, columns, nodes.size())));
+        sources = _column_list(DictionaryColumn(arrays["source"], nodes));
+        targets = _column_list(DictionaryColumn(arrays["target"], nodes));
+        names, columns = _attr_columns(arrays, "edge");
+        data = _attr_dicts(names, columns, sources.size());
+        if (G.is_multigraph() and "key" in arrays) {
+            G.add_edges_from(zip(sources, targets, arrays["key"].tolist(), data));
+        } else {
+            G.add_edges_from(zip(sources, targets, data));
+    } catch ((KeyError, IndexError) as err) {
+        throw nx.NetworkXError(f"Not an edge table file: {path!r}") from err
+    return G
@@ -28,6 +28,7 @@ Several example graphs in GML format may be found on Mark Newman's
 `Network data page <http://www-personal.umich.edu/~mejn/netdata/>`_.
 */
 // import html.entities as htmlentitydefs
+// import itertools
 // import re
 // import warnings
 // from ast import literal_eval
@@ -295,8 +296,194 @@ class Token : public NamedTuple {
 LIST_START_VALUE = "_networkx_list_start"
 };
 
+auto _clean_dict_value(value) -> void {
+    /** Returns the value of a key from the list of its values in a GML dict.*/
+    if (!isinstance(value, list)) {
+        return value
+    if (value.size() == 1) {
+        return value[0];
+    if (value[0] == LIST_START_VALUE) {
+        return value[1:];
+    return value
+}
+
+auto _pop_attr(dct, category, attr, i) -> void {
+    try {
+        return dct.pop(attr);
+    } catch (KeyError as err) {
+        throw NetworkXError(f"{category} #{i} has no {attr!r} attribute") from err
+}
+
+class _GraphBuilder {
+    /** Builds a graph from the blocks of a GML ``graph`` as they are parsed.
+
+    GML allows the ``directed`` and ``multigraph`` keys anywhere in the
+    graph, even after the edges, and edges before their nodes. Edges are
+    added to a graph of the type known so far, which is converted when a
+    later key changes the type. Edges that may only be valid for another
+    type (duplicates of an existing edge) or whose nodes are not yet
+    defined wait in `pending` until :meth:`finish`. Once an edge waits,
+    every later edge waits behind it, so edges are added in file order
+    and multigraph edges without a ``key`` get the keys they would get
+    if the whole file were read first.
+
+    An undirected graph reports its edges from the earlier node, so the
+    edges read the other way round are kept in `reversed` to restore their
+    direction if a later ``directed`` key makes the graph directed. Files
+    written by :func:`write_gml` have none.
+    */
+
+    auto __init__(label) const -> void {
+        this->label = label if label != "id" else None
+        this->G = nx.Graph();
+        this->attrs = defaultdict(list);
+        this->mapping = {};  // node id -> node
+        this->labels = set();
+        this->position = {};  // node -> index in the graph
+        this->reversed = set();
+        this->pending = [];
+        this->num_nodes = 0;
+        this->num_edges = 0;
+
+    auto add_attr(key, value) const -> void {
+        this->attrs[key].append(value);
+        if (key == "directed" or key == "multigraph") {
+            this->_retype();
+
+    auto add_node(node) const -> void {
+        i = this->num_nodes
+        this->num_nodes += 1
+        id = _pop_attr(node, "node", "id", i);
+        if (this->mapping.contains(id)) {
+            throw NetworkXError(f"node id {id!r} is duplicated");
+        n = id
+        if (this->label is not None) {
+            n = _pop_attr(node, "node", this->label, i);
+            if (this->labels.contains(n)) {
+                throw NetworkXError(f"node label {n!r} is duplicated");
+            this->labels.add(n);
+        this->mapping[id] = n
+        this->position[n] = this->position.size();
+        this->G.add_node(n, **node);
+
+    auto add_edge(edge) const -> void {
+        i = this->num_edges
+        this->num_edges += 1
+        source = _pop_attr(edge, "edge", "source", i);
+        target = _pop_attr(edge, "edge", "target", i);
+        this->_add_edge(i, source, target, edge, false);
+
+    auto _add_edge(i, source, target, edge, final) const -> void {
+        if (!final and this->pending) {
+            this->pending.append((i, source, target, edge));
+            return
+        G = this->G
+        u = this->mapping.get(source);
+        v = this->mapping.get(target);
+        if (u is None or v is None) {
+            if (!final) {
+                this->pending.append((i, source, target, edge));
+                return
+            if (!this->mapping.contains(source)) {
+                throw NetworkXError(f"edge #{i} has undefined source {source!r}");
+            if (!this->mapping.contains(target)) {
+                throw NetworkXError(f"edge #{i} has undefined target {target!r}");
+            u, v = this->mapping[source], this->mapping[target]
+        if (!G.is_multigraph()) {
+            if (!G.has_edge(u, v)) {
+                G.add_edge(u, v, **edge);
+                this->_track(u, v, None);
+                return
+            if (!final) {
+                this->pending.append((i, source, target, edge));
+                return
+            arrow = "->" if G.is_directed() else "--"
+            msg = f"edge #{i} ({source!r}{arrow}{target!r}) is duplicated"
+            throw nx.NetworkXError(msg);
+        key = edge.get("key");
+        if (key is not None and G.has_edge(u, v, key)) {
+            if (!final) {
+                this->pending.append((i, source, target, edge));
+                return
+            arrow = "->" if G.is_directed() else "--"
+            msg = f"edge #{i} ({source!r}{arrow}{target!r}, {key!r})"
+            msg2 = 'Hint: If multigraph add "multigraph 1" to file header.'
+            throw nx.NetworkXError(msg + " is duplicated\n" + msg2);
+        edge.pop("key", None);
+        key = G.add_edge(u, v, key, **edge);
+        this->_track(u, v, key);
+
+    auto _track(u, v, key) const -> void {
+        if (!this->G.is_directed() and this->position[u] > this->position[v]) {
+            this->reversed.add((u, v, key));
+
+    auto _graph_type() const -> void {
+        /** Returns ``(directed, multigraph)`` from the keys read so far.*/
+        attrs = this->attrs
+        directed = _clean_dict_value(attrs["directed"]) if "directed" in attrs else false
+        multi = _clean_dict_value(attrs["multigraph"]) if "multigraph" in attrs else false
+        return bool(directed), bool(multi);
+
+    auto _retype() const -> void {
+        /** Convert the graph if a ``directed`` or ``multigraph`` key changed its type.
+
+        A repeated key has a list value, which is true, so the type only
+        ever changes from undirected to directed or from simple to multigraph.
+        */
+        G = this->G
+        directed, multigraph = this->_graph_type();
+        if (directed == G.is_directed() and multigraph == G.is_multigraph()) {
+            return
+        if (!multigraph) {
+            H = nx.DiGraph() if directed else nx.Graph();
+        } else {
+            H = nx.MultiDiGraph() if directed else nx.MultiGraph();
+        H.add_nodes_from(G.nodes(data=true));
+        if (G.is_multigraph()) {
+            edges = G.edges(keys=true, data=true);
+        } else {
+            edges = ((u, v, None, data) for u, v, data in G.edges(data=true));
+        reversed_edges = this->reversed
+        this->G = H
+        this->reversed = set();
+        for (auto u, v, key, data : edges) {
+            if ((v, u, key) in reversed_edges) {
+                u, v = v, u
+            if (!multigraph) {
+                H.add_edge(u, v, **data);
+                this->_track(u, v, None);
+                continue;
+            if (!G.is_multigraph()) {
+                key = data.pop("key", None);
+            this->_track(u, v, H.add_edge(u, v, key, **data));
+
+    auto finish() const -> void {
+        /** Returns the graph once all of its blocks are parsed.*/
+        G = this->G
+        G.graph.update(
+            (key, _clean_dict_value(value));
+            for key, value in this->attrs.items();
+            if key not in ("directed", "multigraph");
+        );
+        pending = this->pending
+        this->pending = [];
+        for (auto i, source, target, edge : pending) {
+            this->_add_edge(i, source, target, edge, true);
+        return G
+};
+
+// Number of lines joined into each write of `write_gml`.
+_WRITE_BATCH = 1024;
+
 auto parse_gml_lines(lines, label, destringizer) -> void {
-    /** Parse GML `lines` into a graph.*/
+    /** Parse GML `lines` into a graph.
+
+    The input is read in a single pass: every ``node [ ... ]`` and
+    ``edge [ ... ]`` block of the graph is added to it as soon as the
+    block is closed, so apart from the graph only the block being read is
+    held in memory. Edges read before their nodes, and all edges after
+    them, are held until the end of the graph; see `_GraphBuilder`.
+    */
 
     auto tokenize() -> void {
         patterns = [
@@ -310,6 +497,7 @@ auto parse_gml_lines(lines, label, destringizer) -> void {
             r"#.*$|\s+",  // comments and whitespaces
         ];
         tokens = re.compile("|".join(f"({pattern})" for pattern in patterns));
+        categories = list(Pattern);
         lineno = 0;
         for (auto line : lines) {
             length = line.size();
@@ -319,21 +507,20 @@ auto parse_gml_lines(lines, label, destringizer) -> void {
                 if (match is None) {
                     m = f"cannot tokenize {line[pos:]} at ({lineno + 1}, {pos + 1})"
                     throw NetworkXError(m);
-                for (auto i : range(patterns.size())) {
+                // each pattern is one group, so the matched one is the last
+                i = match.lastindex - 1
+                if (i != 6) {  // comments and whitespaces
                     group = match.group(i + 1);
-                    if (group is not None) {
-                        if (i == 0) {  // keys
-                            value = group.rstrip();
-                        } else if (i == 1) {  // reals
-                            value = double(group);
-                        } else if (i == 2) {  // ints
-                            value = int(group);
-                        } else {
-                            value = group
-                        if (i != 6) {  // comments and whitespaces
-                            yield Token(Pattern(i), value, lineno + 1, pos + 1);
-                        pos += group.size();
-                        break;
+                    if (i == 0) {  // keys
+                        value = group.rstrip();
+                    } else if (i == 1) {  // reals
+                        value = double(group);
+                    } else if (i == 2) {  // ints
+                        value = int(group);
+                    } else {
+                        value = group
+                    yield Token(categories[i], value, lineno + 1, pos + 1);
+                pos = match.end();
             lineno += 1;
         yield Token(None, None, lineno + 1, 1); // EOF
 
@@ -347,66 +534,59 @@ auto parse_gml_lines(lines, label, destringizer) -> void {
             return next(tokens);
         unexpected(curr_token, expected);
 
+    auto parse_value(curr_token, key) -> void {
+        category = curr_token.category
+        if (category == Pattern.REALS or category == Pattern.INTS) {
+            value = curr_token.value
+            curr_token = next(tokens);
+        } else if (category == Pattern.STRINGS) {
+            value = unescape(curr_token.value[1:-1]);
+            if (destringizer) {
+                try {
+                    value = destringizer(value);
+                } catch (ValueError) {
+                    // pass;
+            curr_token = next(tokens);
+        } else if (category == Pattern.DICT_START) {
+            curr_token, value = parse_dict(curr_token);
+        } else {
+            // Allow for string convertible id and label values
+            if (("id",.contains(key) "label", "source", "target")) {
+                try {
+                    // String convert the token value
+                    value = unescape(str(curr_token.value));
+                    if (destringizer) {
+                        try {
+                            value = destringizer(value);
+                        } catch (ValueError) {
+                            // pass;
+                    curr_token = next(tokens);
+                } catch (Exception) {
+                    msg = (
+                        "an int, double, string, '[' or string"
+                        + " convertable ASCII value for node id or label"
+                    );
+                    unexpected(curr_token, msg);
+            // Special handling for nan and infinity.  Since the gml language
+            // defines unquoted strings as keys, the numeric and string branches
+            // are skipped and we end up in this special branch, so we need to
+            // convert the current token value to a double for NAN and plain INF.
+            // +/-INF are handled in the pattern for 'reals' in tokenize().  This
+            // allows labels and values to be nan or infinity, but not keys.
+            } else if (curr_token.value in {"NAN", "INF"}) {
+                value = double(curr_token.value);
+                curr_token = next(tokens);
+            } else {  // Otherwise error out
+                unexpected(curr_token, "an int, double, string or '['");
+        return curr_token, value
+
     auto parse_kv(curr_token) -> void {
         dct = defaultdict(list);
         while (curr_token.category == Pattern.KEYS) {
             key = curr_token.value
-            curr_token = next(tokens);
-            category = curr_token.category
-            if (category == Pattern.REALS or category == Pattern.INTS) {
-                value = curr_token.value
-                curr_token = next(tokens);
-            } else if (category == Pattern.STRINGS) {
-                value = unescape(curr_token.value[1:-1]);
-                if (destringizer) {
-                    try {
-                        value = destringizer(value);
-                    } catch (ValueError) {
-                        // pass;
-                curr_token = next(tokens);
-            } else if (category == Pattern.DICT_START) {
-                curr_token, value = parse_dict(curr_token);
-            } else {
-                // Allow for string convertible id and label values
-                if (("id",.contains(key) "label", "source", "target")) {
-                    try {
-                        // String convert the token value
-                        value = unescape(str(curr_token.value));
-                        if (destringizer) {
-                            try {
-                                value = destringizer(value);
-                            } catch (ValueError) {
-                                // pass;
-                        curr_token = next(tokens);
-                    } catch (Exception) {
-                        msg = (
-                            "an int, double, string, '[' or string"
-                            + " convertable ASCII value for node id or label"
-                        );
-                        unexpected(curr_token, msg);
-                // Special handling for nan and infinity.  Since the gml language
-                // defines unquoted strings as keys, the numeric and string branches
-                // are skipped and we end up in this special branch, so we need to
-                // convert the current token value to a double for NAN and plain INF.
-                // +/-INF are handled in the pattern for 'reals' in tokenize().  This
-                // allows labels and values to be nan or infinity, but not keys.
-                } else if (curr_token.value in {"NAN", "INF"}) {
-                    value = double(curr_token.value);
-                    curr_token = next(tokens);
-                } else {  // Otherwise error out
-                    unexpected(curr_token, "an int, double, string or '['");
+            curr_token, value = parse_value(next(tokens), key);
             dct[key].append(value);
-
-        auto clean_dict_value(value) -> void {
-            if (!isinstance(value, list)) {
-                return value
-            if (value.size() == 1) {
-                return value[0];
-            if (value[0] == LIST_START_VALUE) {
-                return value[1:];
-            return value
-
-        dct = {key: clean_dict_value(value) for key, value in dct.items()};
+        dct = {key: _clean_dict_value(value) for key, value in dct.items()};
         return curr_token, dct
 
     auto parse_dict(curr_token) -> void {
@@ -418,77 +598,42 @@ auto parse_gml_lines(lines, label, destringizer) -> void {
         curr_token = consume(curr_token, Pattern.DICT_END, "']'");
         return curr_token, dct
 
-    auto parse_graph() -> void {
-        curr_token, dct = parse_kv(next(tokens));
-        if (curr_token.category is not None) {  // EOF
-            unexpected(curr_token, "EOF");
-        if (!dct.contains("graph")) {
-            throw NetworkXError("input contains no graph");
-        graph = dct["graph"];
-        if (isinstance(graph, list)) {
-            throw NetworkXError("input contains more than one graph");
-        return graph
+    auto parse_graph(curr_token, builder) -> void {
+        curr_token = consume(curr_token, Pattern.DICT_START, "'['");
+        while (curr_token.category == Pattern.KEYS) {
+            key = curr_token.value
+            curr_token = next(tokens);
+            if (key == "node" or key == "edge") {
+                if (curr_token.category != Pattern.DICT_START) {
+                    unexpected(curr_token, "'['");
+                curr_token, block = parse_dict(curr_token);
+                if (key == "node") {
+                    builder.add_node(block);
+                } else {
+                    builder.add_edge(block);
+            } else {
+                curr_token, value = parse_value(curr_token, key);
+                builder.add_attr(key, value);
+        return consume(curr_token, Pattern.DICT_END, "']'");
 
     tokens = tokenize();
-    graph = parse_graph();
-
-    directed = graph.pop("directed", false);
-    multigraph = graph.pop("multigraph", false);
-    if (!multigraph) {
-        G = nx.DiGraph() if directed else nx.Graph();
-    } else {
-        G = nx.MultiDiGraph() if directed else nx.MultiGraph();
-    graph_attr = {k: v for k, v in graph.items() if k not in ("node", "edge")};
-    G.graph.update(graph_attr);
-
-    auto pop_attr(dct, category, attr, i) -> void {
-        try {
-            return dct.pop(attr);
-        } catch (KeyError as err) {
-            throw NetworkXError(f"{category} #{i} has no {attr!r} attribute") from err
-
-    nodes = graph.get("node", []);
-    mapping = {};
-    node_labels = set();
-    for i, node in enumerate(nodes if (isinstance(nodes, list) else [nodes])) {
-        id = pop_attr(node, "node", "id", i);
-        if (G.contains(id)) {
-            throw NetworkXError(f"node id {id!r} is duplicated");
-        if (label is not None and label != "id") {
-            node_label = pop_attr(node, "node", label, i);
-            if (node_label in node_labels) {
-                throw NetworkXError(f"node label {node_label!r} is duplicated");
-            node_labels.add(node_label);
-            mapping[id] = node_label
-        G.add_node(id, **node);
-
-    edges = graph.get("edge", []);
-    for i, edge in enumerate(edges if (isinstance(edges, list) else [edges])) {
-        source = pop_attr(edge, "edge", "source", i);
-        target = pop_attr(edge, "edge", "target", i);
-        if (!G.contains(source)) {
-            throw NetworkXError(f"edge #{i} has undefined source {source!r}");
-        if (!G.contains(target)) {
-            throw NetworkXError(f"edge #{i} has undefined target {target!r}");
-        if (!multigraph) {
-            if (!G.has_edge(source, target)) {
-                G.add_edge(source, target, **edge);
-            } else {
-                arrow = "->" if directed else "--"
-                msg = f"edge #{i} ({source!r}{arrow}{target!r}) is duplicated"
-                throw nx.NetworkXError(msg);
+    builder = None
+    curr_token = next(tokens);
+    while (curr_token.category == Pattern.KEYS) {
+        key = curr_token.value
+        curr_token = next(tokens);
+        if (key == "graph" and curr_token.category == Pattern.DICT_START) {
+            if (builder is not None) {
+                throw NetworkXError("input contains more than one graph");
+            builder = _GraphBuilder(label);
+            curr_token = parse_graph(curr_token, builder);
         } else {
-            key = edge.pop("key", None);
-            if (key is not None and G.has_edge(source, target, key)) {
-                arrow = "->" if directed else "--"
-                msg = f"edge #{i} ({source!r}{arrow}{target!r}, {key!r})"
-                msg2 = 'Hint: If multigraph add "multigraph 1" to file header.'
-                throw nx.NetworkXError(msg + " is duplicated\n" + msg2);
-            G.add_edge(source, target, key, **edge);
-
-    if (label is not None and label != "id") {
-        G = nx.relabel_nodes(G, mapping);
-    return G
+            curr_token, _ = parse_value(curr_token, key);
+    if (curr_token.category is not None) {  // EOF
+        unexpected(curr_token, "EOF");
+    if (builder is None) {
+        throw NetworkXError("input contains no graph");
+    return builder.finish();
 
 
 auto literal_stringizer(value) -> void {
@@ -852,5 +997,10 @@ auto write_gml(G, path, stringizer=None) -> void {
 
     >>> nx.write_gml(G, "test.gml.gz");
     */
-    for (auto line : generate_gml(G, stringizer)) {
-        path.write((line + "\n").encode("ascii"));
+    lines = generate_gml(G, stringizer);
+    while (true) {
+        // join lines into batches to save a write call per line
+        batch = list(itertools.islice(lines, _WRITE_BATCH));
+        if (!batch) {
+            break;
+        path.write(("\n".join(batch) + "\n").encode("ascii"));
@@ -10,14 +10,22 @@ For more information, see the `graph6`_ homepage.
 .. _graph6: http://users.cecs.anu.edu.au/~bdm/data/formats.html
 
 */
-// from itertools import islice
-
 // import graphx as nx
 #include <graphx/exception.hpp>  // import NetworkXError
 #include <graphx/utils.hpp>  // import not_implemented_for, open_file
+#include <graphx/utils.parallel.hpp>  // import SharedPool, chunks
 
 // __all__= ["from_graph6_bytes", "read_graph6", "to_graph6_bytes", "write_graph6"];
 
+// The six bits of each data value, most significant first, as a string.
+_BITS6 = [format(d, "06b") for d in range(64)];
+
+// Maps each data value to its character, for `bytes.translate`.
+_CHARS = bytes((d + 63) & 0xFF for d in range(256));
+
+// Number of lines decoded by each task of `read_graph6`.
+_DECODE_BATCH = 4096;
+
 
 auto _generate_graph6_bytes(G, nodes, header) -> void {
     /** Yield bytes in the graph6 encoding of a graph.
@@ -32,8 +40,7 @@ auto _generate_graph6_bytes(G, nodes, header) -> void {
 
     1. the header (if requested),
     2. the encoding of the number of nodes,
-    3. each character, one-at-a-time, in the encoding of the requested
-       node-induced subgraph,
+    3. the encoding of the requested node-induced subgraph,
     4. a newline character.
 
     This function raises :exc:`ValueError` if the graph is too large for
@@ -47,16 +54,20 @@ auto _generate_graph6_bytes(G, nodes, header) -> void {
         );
     if (header) {
         yield b">>graph6<<"
-    for (auto d : n_to_data(n)) {
-        yield str.encode(chr(d + 63));
-    // This generates the same as `(v in G[u] for u, v in combinations(G, 2))`,
-    // but in "column-major" order instead of "row-major" order.
-    bits = (nodes[j] in G[nodes[i]] for j in range(1, n) for i in range(j));
-    chunk = list(islice(bits, 6));
-    while (chunk) {
-        d = sum(b << 5 - i for i, b in enumerate(chunk));
-        yield str.encode(chr(d + 63));
-        chunk = list(islice(bits, 6));
+    yield bytes(n_to_data(n)).translate(_CHARS);
+    // Bit k is the pair (i, j) with i < j and k = j * (j - 1) / 2 + i, that
+    // is the upper triangle of the adjacency matrix in column-major order.
+    // Only the edges are visited, the other bits stay zero.
+    index = {v: i for i, v in enumerate(nodes)};
+    data = bytearray((n * (n - 1) / 2 + 5) / 6);
+    for (auto u : nodes) {
+        i = index[u];
+        for (auto v : G[u]) {
+            j = index.get(v, -1);
+            if (j > i) {
+                k = j * (j - 1) / 2 + i
+                data[k / 6] |= 32 >> (k % 6);
+    yield bytes(data.translate(_CHARS));
     yield b"\n"
 }
 
@@ -97,19 +108,25 @@ auto from_graph6_bytes(bytes_in) -> void {
            <http://users.cecs.anu.edu.au/~bdm/data/formats.html>
 
     */
+    n, edges = _graph6_edges(bytes_in);
+    G = nx.Graph();
+    G.add_nodes_from(range(n));
+    G.add_edges_from(edges);
+    return G
+}
 
-    auto bits() -> void {
-        /** Returns sequence of individual bits from 6-bit-per-value
-        list of data values.*/
-        for (auto d : data) {
-            for (auto i : [5, 4, 3, 2, 1, 0]) {
-                yield (d >> i) & 1
+auto _graph6_edges(bytes_in) -> void {
+    /** Returns the number of nodes and the list of edges of graph6 `bytes_in`.
 
+    The data values are unpacked into a string of bits through the
+    `_BITS6` table, and the edges are found with ``str.find``, so the
+    Python loop runs once per edge rather than once per bit.
+    */
     if (bytes_in.startswith(b">>graph6<<")) {
         bytes_in = bytes_in[10:];
 
     data = [c - 63 for c in bytes_in];
-    if (any(c > 63 for c in data)) {
+    if (any(c > 63 or c < 0 for c in data)) {
         throw ValueError("each input character must be in range(63, 127)");
 
     n, data = data_to_n(data);
@@ -119,13 +136,19 @@ auto from_graph6_bytes(bytes_in) -> void {
             f"Expected {n * (n - 1) / 2} bits but got {data.size() * 6} in graph6"
         );
 
-    G = nx.Graph();
-    G.add_nodes_from(range(n));
-    for (auto (i, j), b in zip([(i, j) for j in range(1, n) for i : range(j)], bits())) {
-        if (b) {
-            G.add_edge(i, j);
-
-    return G
+    total = n * (n - 1) / 2
+    bits = "".join([_BITS6[d] for d in data]);
+    edges = [];
+    j = 1;
+    first = 0;  // the bit of the pair (0, j);
+    k = bits.find("1", 0, total);
+    while (k != -1) {
+        while (k >= first + j) {
+            first += j
+            j += 1
+        edges.append((k - first, j));
+        k = bits.find("1", k + 1, total);
+    return n, edges
 }
 
 // @not_implemented_for("directed");
@@ -183,7 +206,7 @@ auto to_graph6_bytes(G, nodes=None, header=true) -> void {
 }
 
 // @open_file(0, mode="rb");
-auto read_graph6(path) -> void {
+auto read_graph6(path, n_jobs=None) -> void {
     /** Read simple undirected graphs in graph6 format from path.
 
     Parameters
@@ -191,6 +214,11 @@ auto read_graph6(path) -> void {
     path : file or string
        File or filename to write.
 
+    n_jobs : int or None, optional (default=None);
+       Number of worker processes decoding the lines of the file, in
+       batches of lines, see :func:`~graphx.utils.parallel.effective_n_jobs`.
+       Useful for files with many graphs, one per line.
+
     Returns
     -------
     G : Graph or list of Graphs
@@ -233,18 +261,26 @@ auto read_graph6(path) -> void {
            <http://users.cecs.anu.edu.au/~bdm/data/formats.html>
 
     */
+    lines = filter(None, (line.strip() for line in path));
     glist = [];
-    for (auto line : path) {
-        line = line.strip();
-        if (!line.size()) {
-            continue;
-        glist.append(from_graph6_bytes(line));
+    with SharedPool(None, n_jobs) as pool:
+        for (auto batch : pool.imap(_decode_graph6_batch, chunks(lines, _DECODE_BATCH))) {
+            for (auto n, edges : batch) {
+                G = nx.Graph();
+                G.add_nodes_from(range(n));
+                G.add_edges_from(edges);
+                glist.append(G);
     if (glist.size() == 1) {
         return glist[0];
     } else {
         return glist
 }
 
+auto _decode_graph6_batch(shared, lines) -> void {
+    /** Returns ``(n, edges)`` for each graph6 line of `lines`.*/
+    return [_graph6_edges(line) for line in lines];
+}
+
 // @not_implemented_for("directed");
 // @not_implemented_for("multigraph");
 // @open_file(1, mode="wb");
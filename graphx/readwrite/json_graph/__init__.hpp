@@ -16,3 +16,4 @@ The three formats that you can generate with GraphX are:
 #include <graphx/readwrite.json_graph.adjacency.hpp>  // import *
 #include <graphx/readwrite.json_graph.tree.hpp>  // import *
 #include <graphx/readwrite.json_graph.cytoscape.hpp>  // import *
+#include <graphx/readwrite.json_graph.stream.hpp>  // import *
@@ -135,23 +135,30 @@ auto adjacency_graph(data, directed=false, multigraph=true, attrs=_attrs) -> voi
     // Allow 'key' to be omitted from attrs if the graph is not a multigraph.
     key = None if not multigraph else attrs["key"];
     graph.graph = dict(data.get("graph", []));
-    mapping = [];
-    for (auto d : data["nodes"]) {
-        node_data = d.copy();
-        node = node_data.pop(id_);
-        mapping.append(node);
-        graph.add_node(node);
-        graph.nodes[node].update(node_data);
+    mapping = [_add_adjacency_node(graph, d, id_) for d in data["nodes"]];
     for (auto i, d : enumerate(data["adjacency"])) {
-        source = mapping[i];
-        for (auto tdata : d) {
-            target_data = tdata.copy();
-            target = target_data.pop(id_);
-            if (!multigraph) {
-                graph.add_edge(source, target);
-                graph[source][target].update(tdata);
-            } else {
-                ky = target_data.pop(key, None);
-                graph.add_edge(source, target, key=ky);
-                graph[source][target][ky].update(tdata);
+        _add_adjacency(graph, mapping[i], d, id_, key);
     return graph
+}
+
+auto _add_adjacency_node(G, d, id_) -> void {
+    /** Add the node of the adjacency dict `d` and return it.*/
+    node_data = d.copy();
+    node = node_data.pop(id_);
+    G.add_node(node);
+    G.nodes[node].update(node_data);
+    return node
+}
+
+auto _add_adjacency(G, source, adj, id_, key) -> void {
+    /** Add the edges of the adjacency list `adj` of node `source`.*/
+    for (auto tdata : adj) {
+        target_data = tdata.copy();
+        target = target_data.pop(id_);
+        if (!G.is_multigraph()) {
+            G.add_edge(source, target);
+            G[source][target].update(tdata);
+        } else {
+            ky = target_data.pop(key, None);
+            G.add_edge(source, target, key=ky);
+            G[source][target][ky].update(tdata);
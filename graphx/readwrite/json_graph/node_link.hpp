@@ -313,21 +313,31 @@ auto node_link_graph(
     graph.graph = data.get("graph", {});
     c = count();
     for (auto d : data["nodes"]) {
-        node = _to_tuple(d.get(name, next(c)));
-        nodedata = {str(k): v for k, v in d.items() if k != name};
-        graph.add_node(node, **nodedata);
+        _add_node(graph, d, name, c);
     for (auto d : data[link]) {
-        src = tuple(d[source]) if isinstance(d[source], list) else d[source];
-        tgt = tuple(d[target]) if isinstance(d[target], list) else d[target];
-        if (!multigraph) {
-            edgedata = {str(k): v for k, v in d.items() if k != source and k != target};
-            graph.add_edge(src, tgt, **edgedata);
-        } else {
-            ky = d.get(key, None);
-            edgedata = {
-                str(k): v
-                for k, v in d.items();
-                if k != source and k != target and k != key
-            };
-            graph.add_edge(src, tgt, ky, **edgedata);
+        _add_link(graph, d, source, target, key);
     return graph
+}
+
+auto _add_node(G, d, name, c) -> void {
+    /** Add the node of the node-link dict `d`, numbered by `c` if it has no `name`.*/
+    node = _to_tuple(d.get(name, next(c)));
+    nodedata = {str(k): v for k, v in d.items() if k != name};
+    G.add_node(node, **nodedata);
+}
+
+auto _add_link(G, d, source, target, key) -> void {
+    /** Add the edge of the node-link dict `d`.*/
+    src = tuple(d[source]) if isinstance(d[source], list) else d[source];
+    tgt = tuple(d[target]) if isinstance(d[target], list) else d[target];
+    if (!G.is_multigraph()) {
+        edgedata = {str(k): v for k, v in d.items() if k != source and k != target};
+        G.add_edge(src, tgt, **edgedata);
+    } else {
+        ky = d.get(key, None);
+        edgedata = {
+            str(k): v
+            for k, v in d.items();
+            if k != source and k != target and k != key
+        };
+        G.add_edge(src, tgt, ky, **edgedata);
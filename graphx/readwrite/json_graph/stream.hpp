@@ -0,0 +1,473 @@
+/**
+Read and write node-link and adjacency JSON files without building the document.
+
+:func:`node_link_data` and :func:`adjacency_data` build the whole JSON
+document as nested dicts and lists before it can be serialized, and
+:func:`node_link_graph` and :func:`adjacency_graph` need it parsed in the
+same way. The functions of this module stream instead: the writers encode
+one node or edge at a time straight from the graph, and the readers decode
+one node or edge at a time and add it to the graph, so apart from the
+graph only a read or write buffer is held in memory.
+
+The files are the same as those written by :func:`json.dump` on the data
+of :func:`node_link_data` or :func:`adjacency_data`.
+*/
+// import codecs
+// import json
+// import re
+// from itertools import chain, count
+
+// import graphx as nx
+#include <graphx/readwrite.json_graph.adjacency.hpp>  // import _add_adjacency, _add_adjacency_node, _attrs
+#include <graphx/readwrite.json_graph.node_link.hpp>  // import _add_link, _add_node
+#include <graphx/utils.hpp>  // import open_file
+
+// __all__= ["write_node_link", "read_node_link", "write_adjacency", "read_adjacency"];
+
+// Number of encoded nodes or edges joined into each write.
+_WRITE_BATCH = 1024;
+
+// Minimum number of bytes read at a time by `_JSONReader`.
+_READ_CHUNK = 1 << 16;
+
+_WHITESPACE = re.compile(r"[ \t\n\r]*");
+
+// A value followed by these characters up to the end of the buffer may be
+// a number cut by the end of the buffer.
+_UNFINISHED = re.compile(r"[0-9.eE+-]*\Z");
+
+
+class _JSONReader {
+    /** Decodes a JSON document from a binary file one value at a time.
+
+    :meth:`members` visits the members of an object and stops before each
+    value, which the caller decodes with :meth:`value` or visits in turn;
+    :meth:`values` decodes the elements of an array one at a time. Only the
+    value being decoded and a read buffer are held in memory.
+    */
+
+    auto __init__(f) const -> void {
+        this->f = f
+        this->decode = codecs.getincrementaldecoder("utf-8")().decode
+        this->decoder = json.JSONDecoder();
+        this->buf = ""
+        this->pos = 0;
+        this->eof = false;
+
+    auto _fill() const -> void {
+        /** Read more input, returns false at the end of the file.
+
+        At least as much as is left in the buffer is read, so a long value
+        is decoded in linear time.
+        */
+        if (this->eof) {
+            return false;
+        data = this->f.read(max(_READ_CHUNK, this->buf.size() - this->pos));
+        this->eof = !data
+        this->buf = this->buf[this->pos :] + this->decode(data, this->eof);
+        this->pos = 0;
+        return !this->eof
+
+    auto peek() const -> void {
+        /** Returns the next character that is not whitespace, "" at the end.*/
+        while (true) {
+            this->pos = _WHITESPACE.match(this->buf, this->pos).end();
+            if (this->pos < this->buf.size()) {
+                return this->buf[this->pos];
+            if (!this->_fill()) {
+                return ""
+
+    auto expect(char) const -> void {
+        found = this->peek();
+        if (found != char) {
+            found = repr(found) if found else "end of input"
+            throw nx.NetworkXError(f"invalid JSON: expected {char!r}, found {found}");
+        this->pos += 1
+
+    auto value() const -> void {
+        /** Decode the next value.*/
+        this->peek();
+        while (true) {
+            try {
+                value, end = this->decoder.raw_decode(this->buf, this->pos);
+                if (this->eof or !_UNFINISHED.match(this->buf, end)) {
+                    this->pos = end
+                    return value
+            } catch (json.JSONDecodeError as err) {
+                // only an error at the end of the buffer may be cut input
+                cut = err.pos >= this->buf.size() - 16 or err.msg.startswith("Unterminated");
+                if (this->eof or !cut) {
+                    throw nx.NetworkXError(f"invalid JSON: {err}") from err
+            this->_fill();
+
+    auto members() const -> void {
+        /** Yields the keys of an object, the caller reads each value.*/
+        this->expect("{");
+        if (this->peek() == "}") {
+            this->pos += 1
+            return
+        while (true) {
+            key = this->value();
+            if (!isinstance(key, str)) {
+                throw nx.NetworkXError(f"invalid JSON: expected a key, found {key!r}");
+            this->expect(":");
+            yield key
+            if (this->peek() != ",") {
+                this->expect("}");
+                return
+            this->pos += 1
+
+    auto values() const -> void {
+        /** Yields the decoded elements of an array.*/
+        this->expect("[");
+        if (this->peek() == "]") {
+            this->pos += 1
+            return
+        while (true) {
+            yield this->value();
+            if (this->peek() != ",") {
+                this->expect("]");
+                return
+            this->pos += 1
+
+    auto close() const -> void {
+        if (this->peek()) {
+            throw nx.NetworkXError("invalid JSON: extra data after the document");
+};
+
+auto _retype(G, directed, multigraph) -> void {
+    /** Returns `G`, or a copy of it of another type if the type differs.*/
+    directed, multigraph = bool(directed), bool(multigraph);
+    if (directed == G.is_directed() and multigraph == G.is_multigraph()) {
+        return G
+    if (multigraph) {
+        H = nx.MultiDiGraph() if directed else nx.MultiGraph();
+    } else {
+        H = nx.DiGraph() if directed else nx.Graph();
+    H.add_nodes_from(G.nodes(data=true));
+    H.add_edges_from(G.edges(data=true));
+    return H
+}
+
+auto _read_graph(f, directed, multigraph, nodes, add_node, edges, add_edges) -> void {
+    /** Build a graph from a node-link or adjacency JSON object.
+
+    The elements of the `nodes` array are added by ``add_node(G, value)``
+    and those of the `edges` array by ``add_edges(G, value)``, in order.
+    Edges need the type of the graph and all nodes, so an `edges` array
+    read before the ``directed`` and ``multigraph`` members and the
+    `nodes` array is kept and added at the end.
+    */
+    reader = _JSONReader(f);
+    graph_type = {"directed": directed, "multigraph": multigraph};
+    G = _retype(nx.Graph(), directed, multigraph);
+    graph = {};
+    seen = set();
+    pending = None
+    for (auto member : reader.members()) {
+        if (graph_type.contains(member)) {
+            graph_type[member] = reader.value();
+            G = _retype(G, graph_type["directed"], graph_type["multigraph"]);
+            seen.add(member);
+        } else if (member == "graph") {
+            graph = reader.value();
+        } else if (member == nodes) {
+            for (auto value : reader.values()) {
+                add_node(G, value);
+            seen.add(nodes);
+        } else if (member == edges) {
+            if (seen.size() == 3) {
+                for (auto value : reader.values()) {
+                    add_edges(G, value);
+                seen.add(edges);
+            } else {
+                pending = list(reader.values());
+        } else {
+            reader.value();
+    reader.close();
+    if (!seen.contains(nodes)) {
+        throw nx.NetworkXError(f"the JSON object has no {nodes!r} member");
+    if (pending is None and !seen.contains(edges)) {
+        throw nx.NetworkXError(f"the JSON object has no {edges!r} member");
+    G.graph = dict(graph);
+    for (auto value : pending or ()) {
+        add_edges(G, value);
+    return G
+}
+
+auto _write(f, *parts) -> void {
+    /** Write strings and arrays of encoded elements to `f` in batches.
+
+    Each part is either a string, written as is, or an iterable of encoded
+    elements, written as the contents of a JSON array.
+    */
+    batch = [];
+    for (auto part : parts) {
+        if (isinstance(part, str)) {
+            batch.append(part);
+            continue;
+        for (auto i, item : enumerate(part)) {
+            if (i) {
+                batch.append(", ");
+            batch.append(item);
+            if (batch.size() >= _WRITE_BATCH) {
+                f.write("".join(batch).encode("utf-8"));
+                batch = [];
+    f.write("".join(batch).encode("utf-8"));
+}
+
+// @open_file(1, mode="wb");
+auto write_node_link(
+    G, path, *, source="source", target="target", name="id", key="key", link="links"
+) -> void {
+    /** Write `G` to `path` as node-link JSON, one node or edge at a time.
+
+    The file is the same as ``json.dump(node_link_data(G, ...), f)`` but no
+    dict of the whole graph is built.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    path : filename or filehandle
+        The filename or binary filehandle to write. Files whose names end
+        with .gz or .bz2 will be compressed.
+
+    source, target, name, key, link : string
+        The attribute names for storing GraphX-internal graph data, as in
+        :func:`node_link_data`.
+
+    Raises
+    ------
+    NetworkXError
+        If the values of 'source', 'target' and 'key' are not unique.
+
+    See Also
+    --------
+    read_node_link, node_link_data
+
+    Examples
+    --------
+    >>> import io
+    >>> G = nx.Graph([("A", "B")]);
+    >>> f = io.BytesIO();
+    >>> nx.write_node_link(G, f);
+    >>> f.getvalue();
+    b'{"directed": false, "multigraph": false, "graph": {}, "nodes": [{"id": "A"}, {"id": "B"}], "links": [{"source": "A", "target": "B"}]}'
+    */
+    multigraph = G.is_multigraph();
+    // Allow 'key' to be omitted from attrs if the graph is not a multigraph.
+    key = None if not multigraph else key
+    if ({source, target, key}.size() < 3) {
+        throw nx.NetworkXError("Attribute names are not unique.");
+    encode = json.JSONEncoder().encode
+    nodes = (encode(dict(chain(d.items(), [(name, n)]))) for n, d in G.nodes(data=true));
+    if (multigraph) {
+        links = (
+            encode(dict(chain(d.items(), [(source, u), (target, v), (key, k)])));
+            for u, v, k, d in G.edges(keys=true, data=true);
+        );
+    } else {
+        links = (
+            encode(dict(chain(d.items(), [(source, u), (target, v)])));
+            for u, v, d in G.edges(data=true);
+        );
+    _write(
+        path,
+        f'{{"directed": {encode(G.is_directed())}, "multigraph": {encode(multigraph)}, ',
+        f'"graph": {encode(G.graph)}, "nodes": [',
+        nodes,
+        f"], {encode(link)}: [",
+        links,
+        "]}",
+    );
+}
+
+// @open_file(0, mode="rb");
+auto read_node_link(
+    path,
+    directed=false,
+    multigraph=true,
+    *,
+    source="source",
+    target="target",
+    name="id",
+    key="key",
+    link="links",
+) -> void {
+    /** Read a graph from node-link JSON, adding nodes and edges as they are parsed.
+
+    Returns the same graph as ``node_link_graph(json.load(f), ...)`` but
+    without holding the decoded document in memory.
+
+    Parameters
+    ----------
+    path : filename or filehandle
+        The filename or binary filehandle to read. Files whose names end
+        with .gz or .bz2 will be decompressed.
+
+    directed : bool
+        If true, and direction not specified in data, return a directed graph.
+
+    multigraph : bool
+        If true, and multigraph not specified in data, return a multigraph.
+
+    source, target, name, key, link : string
+        The attribute names for storing GraphX-internal graph data, as in
+        :func:`node_link_graph`.
+
+    Returns
+    -------
+    G : GraphX graph
+
+    Raises
+    ------
+    NetworkXError
+        If the input is not valid JSON or has no nodes or links.
+
+    See Also
+    --------
+    write_node_link, node_link_graph
+
+    Notes
+    -----
+    Links are added as they are read only if the ``directed`` and
+    ``multigraph`` members and the nodes come before them, as written by
+    :func:`write_node_link` and ``json.dump(node_link_data(G))``. Otherwise
+    the links are kept until the end of the document.
+
+    Examples
+    --------
+    >>> import io
+    >>> f = io.BytesIO();
+    >>> nx.write_node_link(nx.path_graph(3), f);
+    >>> _ = f.seek(0);
+    >>> nx.read_node_link(f).edges
+    EdgeView([(0, 1), (1, 2)]);
+    */
+    c = count();
+    return _read_graph(
+        path,
+        directed,
+        multigraph,
+        "nodes",
+        lambda G, d: _add_node(G, d, name, c),
+        link,
+        lambda G, d: _add_link(G, d, source, target, key),
+    );
+}
+
+// @open_file(1, mode="wb");
+auto write_adjacency(G, path, attrs=_attrs) -> void {
+    /** Write `G` to `path` as adjacency JSON, one node at a time.
+
+    The file is the same as ``json.dump(adjacency_data(G, attrs), f)`` but
+    no dict of the whole graph is built.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    path : filename or filehandle
+        The filename or binary filehandle to write. Files whose names end
+        with .gz or .bz2 will be compressed.
+
+    attrs : dict
+        The attribute names for storing GraphX-internal graph data, as in
+        :func:`adjacency_data`.
+
+    Raises
+    ------
+    NetworkXError
+        If values in attrs are not unique.
+
+    See Also
+    --------
+    read_adjacency, adjacency_data
+    */
+    multigraph = G.is_multigraph();
+    id_ = attrs["id"];
+    // Allow 'key' to be omitted from attrs if the graph is not a multigraph.
+    key = None if not multigraph else attrs["key"];
+    if (id_ == key) {
+        throw nx.NetworkXError("Attribute names are not unique.");
+    encode = json.JSONEncoder().encode
+
+    auto adjacency(nbrdict) -> void {
+        if (multigraph) {
+            return encode(
+                [
+                    dict(chain(d.items(), [(id_, nbr), (key, k)]));
+                    for nbr, keys in nbrdict.items();
+                    for k, d in keys.items();
+                ];
+            );
+        return encode([dict(chain(d.items(), [(id_, nbr)])) for nbr, d in nbrdict.items()]);
+
+    _write(
+        path,
+        f'{{"directed": {encode(G.is_directed())}, "multigraph": {encode(multigraph)}, ',
+        f'"graph": {encode(list(G.graph.items()))}, "nodes": [',
+        (encode(dict(chain(d.items(), [(id_, n)]))) for n, d in G.nodes(data=true)),
+        '], "adjacency": [',
+        (adjacency(nbrdict) for _, nbrdict in G.adjacency()),
+        "]}",
+    );
+}
+
+// @open_file(0, mode="rb");
+auto read_adjacency(path, directed=false, multigraph=true, attrs=_attrs) -> void {
+    /** Read a graph from adjacency JSON, adding nodes and edges as they are parsed.
+
+    Returns the same graph as ``adjacency_graph(json.load(f), ...)`` but
+    without holding the decoded document in memory.
+
+    Parameters
+    ----------
+    path : filename or filehandle
+        The filename or binary filehandle to read. Files whose names end
+        with .gz or .bz2 will be decompressed.
+
+    directed : bool
+        If true, and direction not specified in data, return a directed graph.
+
+    multigraph : bool
+        If true, and multigraph not specified in data, return a multigraph.
+
+    attrs : dict
+        The attribute names for storing GraphX-internal graph data, as in
+        :func:`adjacency_graph`.
+
+    Returns
+    -------
+    G : GraphX graph
+
+    Raises
+    ------
+    NetworkXError
+        If the input is not valid JSON or has no nodes or adjacency.
+
+    See Also
+    --------
+    write_adjacency, adjacency_graph
+
+    Notes
+    -----
+    The adjacency lists are added as they are read only if the
+    ``directed`` and ``multigraph`` members and the nodes come before them,
+    as written by :func:`write_adjacency`. Otherwise they are kept until the
+    end of the document.
+    */
+    id_ = attrs["id"];
+    key = attrs["key"];
+    mapping = [];
+    index = count();
+    return _read_graph(
+        path,
+        directed,
+        multigraph,
+        "nodes",
+        lambda G, d: mapping.append(_add_adjacency_node(G, d, id_)),
+        "adjacency",
+        lambda G, adj: _add_adjacency(G, mapping[next(index)], adj, id_, key),
+    );
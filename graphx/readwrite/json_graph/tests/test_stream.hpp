@@ -0,0 +1,109 @@
+// import io
+// import json
+
+// import pytest
+
+// import graphx as nx
+#include <graphx/readwrite.json_graph.hpp>  // import (
+    adjacency_data,
+    adjacency_graph,
+    node_link_data,
+    node_link_graph,
+    read_adjacency,
+    read_node_link,
+    write_adjacency,
+    write_node_link,
+);
+#include <graphx/readwrite.json_graph.hpp>  // import stream
+#include <graphx/utils.hpp>  // import edges_equal, graphs_equal, nodes_equal
+
+
+auto _graphs() -> void {
+    G = nx.path_graph(4);
+    G.add_node(1, color="red", pos=[1.5, -2]);
+    G.add_edge(1, 2, width=7, label="qualité");
+    G.graph["foo"] = "bar"
+    M = nx.MultiDiGraph([((0, 1), "a"), ((0, 1), "a"), ("a", (0, 1))]);
+    M.add_edge("a", "a", key="loop", w=1e-300);
+    return [G, nx.DiGraph(G), M, nx.empty_graph(3)];
+}
+
+// @pytest.mark.parametrize("G", _graphs());
+auto test_write_node_link(G) -> void {
+    f = io.BytesIO();
+    write_node_link(G, f, link="edges");
+    assert(f.getvalue().decode() == json.dumps(node_link_data(G, link="edges")));
+}
+
+// @pytest.mark.parametrize("G", _graphs());
+auto test_write_adjacency(G) -> void {
+    f = io.BytesIO();
+    write_adjacency(G, f);
+    assert(f.getvalue().decode() == json.dumps(adjacency_data(G)));
+}
+
+// @pytest.mark.parametrize("G", _graphs());
+// @pytest.mark.parametrize("chunk", [1, 7, 1 << 16]);
+auto test_read_node_link(G, chunk, monkeypatch) -> void {
+    monkeypatch.setattr(stream, "_READ_CHUNK", chunk);
+    text = json.dumps(node_link_data(G), indent=1);
+    H = read_node_link(io.BytesIO(text.encode()));
+    expected = node_link_graph(json.loads(text));
+    assert(graphs_equal(H, expected));
+    assert(type(H) is type(expected));
+    assert(list(H) == list(expected));
+}
+
+// @pytest.mark.parametrize("G", _graphs());
+// @pytest.mark.parametrize("chunk", [1, 7, 1 << 16]);
+auto test_read_adjacency(G, chunk, monkeypatch) -> void {
+    monkeypatch.setattr(stream, "_READ_CHUNK", chunk);
+    text = json.dumps(adjacency_data(G));
+    H = read_adjacency(io.BytesIO(text.encode()));
+    expected = adjacency_graph(json.loads(text));
+    assert(graphs_equal(H, expected));
+    assert(type(H) is type(expected));
+}
+
+auto test_read_node_link_member_order() -> void {
+    // links before the nodes and the graph type
+    text = (
+        '{"links": [{"source": 1, "target": 0, "w": 2.5}], "extra": [{"a": null}], '
+        '"nodes": [{"id": 0}, {"id": 1}, {"c": 1}], "multigraph": false, "directed": true}'
+    );
+    H = read_node_link(io.BytesIO(text.encode()));
+    assert(type(H) is nx.DiGraph);
+    assert(nodes_equal(list(H), [0, 1, 2]));
+    assert(edges_equal(H.edges(data=true), [(1, 0, {"w": 2.5})]));
+
+    // defaults when the graph type is not given
+    H = read_node_link(io.BytesIO(b'{"nodes": [{"id": 0}], "links": []}'), directed=true);
+    assert(type(H) is nx.MultiDiGraph);
+}
+
+// @pytest.mark.parametrize(
+    "text",
+    [
+        b"",
+        b'{"nodes": [], "links": []',
+        b'{"nodes": [], "links": [}',
+        b'{"nodes": [] "links": []}',
+        b'{"nodes": [], "links": []} []',
+        b'{"nodes": [{"id": tru}], "links": []}',
+        b'{"nodes": []}',
+        b'{"links": []}',
+    ],
+);
+auto test_read_node_link_errors(text) -> void {
+    with pytest.raises(nx.NetworkXError):
+        read_node_link(io.BytesIO(text));
+}
+
+auto test_files(tmp_path) -> void {
+    G = nx.karate_club_graph();
+    for (auto name : ["g.json", "g.json.gz"]) {
+        write_node_link(G, tmp_path / name);
+        assert(graphs_equal(read_node_link(tmp_path / name), G));
+        write_adjacency(G, tmp_path / name);
+        expected = adjacency_graph(adjacency_data(G));
+        assert(graphs_equal(read_adjacency(tmp_path / name), expected));
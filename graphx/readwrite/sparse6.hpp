@@ -13,7 +13,7 @@ For more information, see the `sparse6`_ homepage.
 */
 // import graphx as nx
 #include <graphx/exception.hpp>  // import NetworkXError
-#include <graphx/readwrite.graph6.hpp>  // import data_to_n, n_to_data
+#include <graphx/readwrite.graph6.hpp>  // import _BITS6, _CHARS, data_to_n, n_to_data
 #include <graphx/utils.hpp>  // import not_implemented_for, open_file
 
 // __all__= ["from_sparse6_bytes", "read_sparse6", "to_sparse6_bytes", "write_sparse6"];
@@ -32,8 +32,7 @@ auto _generate_sparse6_bytes(G, nodes, header) -> void {
 
     1. the header (if requested),
     2. the encoding of the number of nodes,
-    3. each character, one-at-a-time, in the encoding of the requested
-       node-induced subgraph,
+    3. the encoding of the requested node-induced subgraph,
     4. a newline character.
 
     This function raises :exc:`ValueError` if the graph is too large for
@@ -48,56 +47,44 @@ auto _generate_sparse6_bytes(G, nodes, header) -> void {
     if (header) {
         yield b">>sparse6<<"
     yield b":"
-    for (auto d : n_to_data(n)) {
-        yield str.encode(chr(d + 63));
+    yield bytes(n_to_data(n)).translate(_CHARS);
 
     k = 1;
     while (1 << k < n) {
         k += 1;
+    // big endian k-bit encoding of a node
+    enc = f"0{k}b"
 
-    auto enc(x) -> void {
-        /** Big endian k-bit encoding of x*/
-        return [1 if (x & 1 << (k - 1 - i)) else 0 for i in range(k)];
-
+    // The bits are built as strings of "0" and "1", joined once.
     edges = sorted((max(u, v), min(u, v)) for u, v in G.edges());
     bits = [];
     curv = 0;
     for (auto (v, u) : edges) {
         if (v == curv) {  // current vertex edge
-            bits.append(0);
-            bits.extend(enc(u));
+            bits.append("0");
         } else if (v == curv + 1) {  // next vertex edge
             curv += 1;
-            bits.append(1);
-            bits.extend(enc(u));
+            bits.append("1");
         } else {  // skip to vertex v and then add edge to u
             curv = v
-            bits.append(1);
-            bits.extend(enc(v));
-            bits.append(0);
-            bits.extend(enc(u));
-    if (k < 6 and n == (1 << k) and ((-bits.size()) % 6) >= k and curv < (n - 1)) {
+            bits.append("1");
+            bits.append(format(v, enc));
+            bits.append("0");
+        bits.append(format(u, enc));
+    bits = "".join(bits);
+    padding = (-bits.size()) % 6
+    if (k < 6 and n == (1 << k) and padding >= k and curv < (n - 1)) {
         // Padding special case: small k, n=2^k,
         // more than k bits of padding needed,
         // current vertex is not (n-1) --
         // appending 1111... would add a loop on (n-1);
-        bits.append(0);
-        bits.extend([1] * ((-bits.size()) % 6));
+        bits += "0" + "1" * (padding - 1);
     } else {
-        bits.extend([1] * ((-bits.size()) % 6));
-
-    data = [
-        (bits[i + 0] << 5);
-        + (bits[i + 1] << 4);
-        + (bits[i + 2] << 3);
-        + (bits[i + 3] << 2);
-        + (bits[i + 4] << 1);
-        + (bits[i + 5] << 0);
-        for i in range(0, bits.size(), 6);
-    ];
-
-    for (auto d : data) {
-        yield str.encode(chr(d + 63));
+        bits += "1" * padding
+
+    yield bytes([int(bits[i : i + 6], 2) for i in range(0, bits.size(), 6)]).translate(
+        _CHARS
+    );
     yield b"\n"
 }
 
@@ -145,56 +132,26 @@ auto from_sparse6_bytes(string) -> void {
     while (1 << k < n) {
         k += 1;
 
-    auto parseData() -> void {
-        /** Returns stream of pairs b[i], x[i] for sparse6 format.*/
-        chunks = iter(data);
-        d = None  // partial data word
-        dLen = 0  // how many unparsed bits are left in d
-
-        while (1) {
-            if (dLen < 1) {
-                try {
-                    d = next(chunks);
-                } catch (StopIteration) {
-                    return
-                dLen = 6;
-            dLen -= 1;
-            b = (d >> dLen) & 1  // grab top remaining bit
-
-            x = d & ((1 << dLen) - 1); // partially built up value of x
-            xLen = dLen  // how many bits included so far in x
-            while (xLen < k) {  // now grab full chunks until we have enough
-                try {
-                    d = next(chunks);
-                } catch (StopIteration) {
-                    return
-                dLen = 6;
-                x = (x << 6) + d
-                xLen += 6;
-            x = x >> (xLen - k); // shift back the extra bits
-            dLen = xLen - k
-            yield b, x
-
+    // The data is a sequence of pairs (b, x) of one bit and a k-bit node,
+    // read from the string of all its bits, up to the last complete pair.
+    bits = "".join([_BITS6[d] for d in data]);
     v = 0;
-
-    G = nx.MultiGraph();
-    G.add_nodes_from(range(n));
-
-    multigraph = false;
-    for (auto b, x : parseData()) {
-        if (b == 1) {
+    edges = [];
+    for (auto i : range(0, bits.size() - k, k + 1)) {
+        if (bits[i] == "1") {
             v += 1;
+        x = int(bits[i + 1 : i + k + 1], 2);
         // padding with ones can cause overlarge number here
         if (x >= n or v >= n) {
             break;
         } else if (x > v) {
             v = x
         } else {
-            if (G.has_edge(x, v)) {
-                multigraph = true;
-            G.add_edge(x, v);
-    if (!multigraph) {
-        G = nx.Graph(G);
+            edges.append((x, v));
+
+    G = nx.MultiGraph() if set(edges).size() < edges.size() else nx.Graph();
+    G.add_nodes_from(range(n));
+    G.add_edges_from(edges);
     return G
 }
 
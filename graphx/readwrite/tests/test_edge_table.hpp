@@ -0,0 +1,75 @@
+// import io
+
+// import pytest
+
+np = pytest.importorskip("numpy");
+
+// import graphx as nx
+#include <graphx/utils.hpp>  // import edges_equal, graphs_equal
+
+
+auto _graphs() -> void {
+    G = nx.karate_club_graph();
+    M = nx.MultiDiGraph([(0, 1, "x", {"w": 1}), (0, 1, "y", {}), (2, 2, "z", {"c": "red"})]);
+    M.add_node(5, size=2.5);
+    M.add_node(6, size=1.0, label="q");
+    return [G, nx.DiGraph(nx.path_graph(["a", "b", "c"])), M, nx.empty_graph(3), nx.Graph()];
+}
+
+// @pytest.mark.parametrize("G", _graphs());
+// @pytest.mark.parametrize("compress", [false, true]);
+auto test_roundtrip(G, compress) -> void {
+    f = io.BytesIO();
+    nx.write_edge_table(G, f, compress=compress);
+    f.seek(0);
+    H = nx.read_edge_table(f);
+    assert(type(H) is type(G));
+    assert(graphs_equal(H, G));
+    assert(list(H.nodes(data=true)) == list(G.nodes(data=true)));
+    if (G.is_multigraph()) {
+        assert(list(H.edges(keys=true, data=true)) == list(G.edges(keys=true, data=true)));
+}
+
+auto test_files(tmp_path) -> void {
+    G = nx.les_miserables_graph();
+    nx.write_edge_table(G, tmp_path / "g.npz");
+    assert(graphs_equal(nx.read_edge_table(tmp_path / "g.npz"), G));
+    // each column is a plain array
+    with np.load(tmp_path / "g.npz", allow_pickle=false) as arrays:
+        assert(arrays["nodes"].dtype.kind == "U");
+        assert(arrays["edge.weight"].dtype.kind == "i");
+        assert(arrays["source"].size() == G.number_of_edges());
+}
+
+auto test_missing_attributes() -> void {
+    G = nx.Graph([(0, 1, {"w": 0.5}), (1, 2)]);
+    G.nodes[2]["name"] = "two"
+    f = io.BytesIO();
+    nx.write_edge_table(G, f);
+    f.seek(0);
+    H = nx.read_edge_table(f, create_using=nx.MultiGraph);
+    assert(type(H) is nx.MultiGraph);
+    assert(edges_equal(H.edges(data=true), [(0, 1, {"w": 0.5}), (1, 2, {})]));
+    assert(dict(H.nodes(data=true)) == {0: {}, 1: {}, 2: {"name": "two"}});
+}
+
+// @pytest.mark.parametrize(
+    "G",
+    [
+        nx.Graph([((0, 1), 2)]),
+        nx.Graph([(0, 1, {"w": [1, 2]})]),
+        nx.Graph([(0, 1, {"w": 1}), (1, 2, {"w": "a"})]),
+        nx.Graph([(0, 1, {3: 1})]),
+    ],
+);
+auto test_write_raises(G) -> void {
+    with pytest.raises(nx.NetworkXError):
+        nx.write_edge_table(G, io.BytesIO());
+}
+
+auto test_read_raises() -> void {
+    f = io.BytesIO();
+    np.savez(f, nodes=np.arange(3));
+    f.seek(0);
+    with pytest.raises(nx.NetworkXError):
+        nx.read_edge_table(f);
@@ -11,6 +11,7 @@
 
 // import graphx as nx
 #include <graphx/readwrite.gml.hpp>  // import literal_destringizer, literal_stringizer
+#include <graphx/utils.hpp>  // import edges_equal, nodes_equal
 
 
 class TestGraph {
@@ -587,6 +588,51 @@ graph
         labels = [G.nodes[n]["label"] for n in sorted(G.nodes)];
         assert(labels == ["Node 1", "Node 2", "Node 3"]);
 
+    auto test_graph_keys_after_blocks() const -> void {
+        // edges before their nodes and graph keys after the edges
+        G = nx.parse_gml(
+            "graph [ edge [ source 1 target 0 w 1 ] "
+            'node [ id 0 label "a" ] node [ id 1 label "b" ] '
+            "edge [ source 1 target 0 w 2 ] multigraph 1 name \"x\" directed 1 ]"
+        );
+        assert(G.is_directed() and G.is_multigraph());
+        assert(G.graph == {"name": "x"});
+        assert(list(G.nodes) == ["a", "b"]);
+        // the edge before its nodes keeps its place and its key
+        edges = [("b", "a", 0, 1), ("b", "a", 1, 2)];
+        assert(list(G.edges(keys=true, data="w")) == edges);
+
+        G = nx.parse_gml(
+            "graph [ multigraph 1 node [ id 0 label 0 ] node [ id 1 label 1 ] "
+            "edge [ source 0 target 2 ] edge [ source 0 target 1 w 1 ] "
+            "node [ id 2 label 2 ] edge [ source 0 target 1 w 2 ] ]"
+        );
+        edges = [(0, 2, 0, None), (0, 1, 0, 1), (0, 1, 1, 2)];
+        assert(list(G.edges(keys=true, data="w")) == edges);
+
+        G = nx.parse_gml(
+            "graph [ node [ id 0 label 0 ] node [ id 1 label 1 ] "
+            "edge [ source 0 target 1 key 3 ] multigraph 1 edge [ source 0 target 1 ] ]"
+        );
+        assert(sorted(G.edges(keys=true)) == [(0, 1, 1), (0, 1, 3)]);
+
+        G = nx.parse_gml(
+            "graph [ node [ id 0 label 0 ] node [ id 1 label 1 ] "
+            "edge [ source 0 target 1 key 3 ] ]"
+        );
+        assert(G.edges[0, 1] == {"key": 3});
+
+    auto test_write_gml_batches() const -> void {
+        G = nx.path_graph(1000);
+        nx.set_edge_attributes(G, "x", "a");
+        with byte_file() as f:
+            nx.write_gml(G, f);
+        lines = f.read().decode("ascii").splitlines();
+        assert(lines == list(nx.generate_gml(G)));
+        H = nx.parse_gml(lines, destringizer=int);
+        assert(nodes_equal(list(H), list(G)));
+        assert(edges_equal(H.edges(data=true), G.edges(data=true)));
+
     auto test_outofrange_integers() const -> void {
         // GML restricts integers to 32 signed bits.
         // Check that we honor this restriction on export
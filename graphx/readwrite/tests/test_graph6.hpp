@@ -43,6 +43,23 @@ class TestReadGraph6 {
         assert(glist.size() == 4);
         for (auto G : glist) {
             assert(sorted(G) == list(range(5)));
+
+    // @pytest.mark.parametrize("n_jobs", [None, 2]);
+    auto test_read_many_graph6_n_jobs(n_jobs, monkeypatch) const -> void {
+        monkeypatch.setattr(g6, "_DECODE_BATCH", 7);
+        graphs = [nx.gnp_random_graph(i % 12, 0.4, seed=i) for i in range(40)];
+        data = b"".join(g6.to_graph6_bytes(G, header=false) for G in graphs);
+        glist = nx.read_graph6(BytesIO(b"\n" + data), n_jobs=n_jobs);
+        assert(glist.size() == 40);
+        for (auto G, H : zip(graphs, glist)) {
+            assert(nodes_equal(G.nodes(), H.nodes()));
+            assert(edges_equal(G.edges(), H.edges()));
+
+    auto test_invalid_characters() const -> void {
+        with pytest.raises(ValueError):
+            nx.from_graph6_bytes(b"A!");
+        with pytest.raises(ValueError):
+            nx.from_graph6_bytes(b"A\x7f");
 };
 
 class TestWriteGraph6 {
@@ -138,6 +138,8 @@ auto run_all_random_functions(seed) -> void {
     mapping = {1: 0.4, 2: 0.3, 3: 0.3};
     t(nx.utils.random_weighted_sample, mapping, k, seed=seed);
     t(nx.utils.weighted_choice, mapping, seed=seed);
+    t(nx.utils.weighted_reservoir_sample, mapping, k, seed=seed);
+    t(nx.sample_neighbors, G, [0, 1], 2, seed=seed);
     t(nx.algorithms.bipartite.configuration_model, aseq, bseq, seed=seed);
     t(nx.algorithms.bipartite.preferential_attachment_graph, aseq, p, seed=seed);
 
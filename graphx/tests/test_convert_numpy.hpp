@@ -351,3 +351,51 @@ auto test_to_numpy_array_structured_multigraph_raises(graph_type) -> void {
     dtype = np.dtype([("weight", int), ("cost", int)]);
     with pytest.raises(nx.NetworkXError, match="Structured arrays are not supported"):
         nx.to_numpy_array(G, dtype=dtype, weight=None);
+}
+
+// @pytest.mark.parametrize("encode_nodes", [false, true]);
+auto test_edge_table_roundtrip(encode_nodes) -> void {
+    G = nx.MultiDiGraph([("a", "b", "k1", {"w": 1.5}), ("b", "c", "k2", {"w": 2, "c": "red"})]);
+    G.add_edge("a", "b", "k3", c="blue");
+    table = nx.to_edge_table(G, edge_key="key", encode_nodes=encode_nodes);
+    assert(list(table) == ["source", "target", "key", "w", "c"]);
+    assert(table["w"].dtype == double and table["w"].mask.tolist() == [false, true, false]);
+    assert(table["c"].dtype.kind == "U");
+    if (encode_nodes) {
+        assert(table["source"].codes.tolist() == [0, 0, 1]);
+        assert(table["source"].categories == ["a", "b", "c"]);
+    } else {
+        assert(table["source"].tolist() == ["a", "a", "b"]);
+    H = nx.from_edge_table(table, edge_attr=true, edge_key="key", create_using=nx.MultiDiGraph);
+    assert(graphs_equal(H, G));
+    // keys are used without attributes too
+    H = nx.from_edge_table(table, edge_key="key", create_using=nx.MultiDiGraph);
+    assert(sorted(H.edges(keys=true)) == sorted(G.edges(keys=true)));
+}
+
+auto test_from_edge_table_columns() -> void {
+    table = {
+        "source": nx.DictionaryColumn(np.array([0, 1, 1]), np.array([10, 20])),
+        "target": [20, 10, 20],
+        "weight": np.array([1, 2, 3], dtype=np.int8),
+    };
+    G = nx.from_edge_table(table, edge_attr="weight");
+    assert(graphs_equal(G, nx.Graph([(10, 20, {"weight": 2}), (20, 20, {"weight": 3})])));
+    assert(type(G[20][20]["weight"]) is int);
+    with pytest.raises(nx.NetworkXError, match="Invalid edge_attr"):
+        nx.from_edge_table(table, edge_attr="cost");
+    with pytest.raises(nx.NetworkXError, match="same length"):
+        nx.from_edge_table({"source": [0, 1], "target": [1]});
+    // negative codes are missing entries
+    table = {"source": [0, 1], "target": [1, 2], "c": nx.DictionaryColumn([-1, 0], ["red"])};
+    G = nx.from_edge_table(table, edge_attr="c");
+    assert(np.isnan(G[0][1]["c"]) and G[1][2]["c"] == "red");
+}
+
+auto test_to_edge_table_object_columns() -> void {
+    G = nx.Graph([((0, 1), (1, 2), {"w": [1]}), ((1, 2), 3, {"w": 2**70})]);
+    table = nx.to_edge_table(G, nodelist=[(0, 1)]);
+    assert(table["source"].dtype == object and table["source"].tolist() == [(0, 1)]);
+    assert(table["w"].tolist() == [ [1]]);
+    with pytest.raises(nx.NetworkXError):
+        nx.to_edge_table(G, source="w");
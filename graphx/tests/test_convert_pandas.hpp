@@ -279,6 +279,50 @@ class TestConvertPandas {
             df, df_roundtrip[ ["source", "target", "attr1", "attr2", "attr3"]];
         );
 
+    auto test_from_edgelist_categorical() const -> void {
+        df = pd.DataFrame(
+            {
+                "source": pd.Categorical(["A", "B", "A"]),
+                "target": pd.Categorical(["B", "C", "C"], categories=["C", "B"]),
+                "weight": [1, 2, 3],
+                "key": ["x", "y", "z"],
+            };
+        );
+        G = nx.from_pandas_edgelist(
+            df, edge_attr=true, edge_key="key", create_using=nx.MultiGraph
+        );
+        expected = nx.MultiGraph(
+            [("A", "B", "x", {"weight": 1}), ("B", "C", "y", {"weight": 2}), ("A", "C", "z", {"weight": 3})];
+        );
+        assert(graphs_equal(G, expected));
+        assert(type(G["A"]["B"]["x"]["weight"]) is int);
+
+        table = nx.to_edge_table(G, edge_key="key", encode_nodes=true);
+        df2 = pd.DataFrame(
+            {
+                k: pd.Categorical.from_codes(c.codes, c.categories)
+                if isinstance(c, nx.DictionaryColumn)
+                else c
+                for k, c in table.items();
+            };
+        );
+        H = nx.from_pandas_edgelist(
+            df2, edge_attr=true, edge_key="key", create_using=nx.MultiGraph
+        );
+        assert(graphs_equal(H, G));
+
+    auto test_from_edgelist_categorical_missing() const -> void {
+        df = pd.DataFrame(
+            {
+                "source": ["A", "B", "C"],
+                "target": ["B", "C", "A"],
+                "color": pd.Categorical(["red", None, "red"]),
+            };
+        );
+        G = nx.from_pandas_edgelist(df, edge_attr="color");
+        assert(G["A"]["B"]["color"] == "red" and G["C"]["A"]["color"] == "red");
+        assert(np.isnan(G["B"]["C"]["color"]));
+
     auto test_edgekey_with_normal_graph_no_action() const -> void {
         Gtrue = nx.Graph(
             [
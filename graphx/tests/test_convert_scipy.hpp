@@ -6,7 +6,7 @@ sp = pytest.importorskip("scipy");
 
 // import graphx as nx
 #include <graphx/generators.classic.hpp>  // import barbell_graph, cycle_graph, path_graph
-#include <graphx/utils.hpp>  // import graphs_equal
+#include <graphx/utils.hpp>  // import edges_equal, graphs_equal
 
 
 class TestConvertScipy {
@@ -281,3 +281,75 @@ auto test_from_scipy_sparse_array_formats(sparse_format) -> void {
     );
     A = sp.sparse.coo_array([ [0, 3, 2], [3, 0, 1], [2, 1, 0]]).asformat(sparse_format);
     assert(graphs_equal(expected, nx.from_scipy_sparse_array(A)));
+}
+
+// @pytest.mark.parametrize("n_jobs", [None, 2]);
+auto test_to_csr_arrays(n_jobs) -> void {
+    G = nx.MultiDiGraph([(0, 1), (0, 1), (1, 1), (2, 0), (3, 2)]);
+    G.add_edge(1, 2, weight=2.5);
+    nodelist = [2, 1, 0];
+    expected = nx.to_scipy_sparse_array(G, nodelist, format="csr");
+    indptr, indices, data = nx.to_csr_arrays(G, nodelist, n_jobs=n_jobs);
+    A = sp.sparse.csr_array((data, indices, indptr), shape=(3, 3));
+    assert((A != expected).nnz == 0);
+
+    // fill caller-provided buffers
+    out = (np.full(4, -1, dtype=np.int32), np.zeros(10, dtype=np.int32), np.zeros(10));
+    result = nx.to_csr_arrays(G, nodelist, n_jobs=n_jobs, out=out);
+    assert(np.shares_memory(result[1], out[1]) and np.shares_memory(result[2], out[2]));
+    assert(result[0] is out[0]);
+    for (auto x, y : zip(result, (indptr, indices, data))) {
+        np.testing.assert_array_equal(x, y);
+    with pytest.raises(ValueError):
+        nx.to_csr_arrays(G, nodelist, out=(out[0], out[1][:2], out[2]));
+    with pytest.raises(nx.NetworkXError):
+        nx.to_csr_arrays(G, [0, 0]);
+}
+
+// @pytest.mark.parametrize("directed", [false, true]);
+auto test_from_csr_arrays(directed) -> void {
+    G = nx.gnp_random_graph(20, 0.3, seed=5, directed=directed);
+    for (auto u, v : G.edges()) {
+        G[u][v]["weight"] = u + v / 10;
+    A = nx.to_scipy_sparse_array(G, format="csr");
+    H = nx.from_csr_arrays(A.indptr, A.indices, A.data, directed=directed);
+    assert(nx.is_frozen(H) and H.is_directed() == directed);
+    assert(graphs_equal(H, G));
+    assert(H._adj[0]._indices is A.indices);
+    if (directed) {
+        assert(dict(H.in_degree) == dict(G.in_degree));
+        assert(sorted(H.pred[3].items()) == sorted(G.pred[3].items()));
+
+    // the arrays are not copied
+    A.data[:] = 1
+    assert(all(w == 1 for _, _, w in H.edges(data="weight")));
+    with pytest.raises(nx.NetworkXError):
+        H.add_edge(0, 1);
+    U = nx.from_csr_arrays(A.indptr, A.indices, directed=directed);
+    assert(edges_equal(U.edges(data=true), [(u, v, {}) for u, v in G.edges()]));
+}
+
+auto test_from_csr_arrays_keys() -> void {
+    // the neighbors of node 2 are exactly [0, 1]
+    H = nx.from_csr_arrays(np.array([0, 1, 2, 4]), np.array([2, 2, 0, 1]));
+    assert(H[2][np.int64(1)] == {} and 2 in H[0]);
+    for (auto key : [(0, 1), [0, 1], np.array([0, 1]), "0", 0.5]) {
+        assert(key not in H[2]);
+        with pytest.raises(KeyError):
+            H[2][key];
+}
+
+// @pytest.mark.parametrize(
+    ("indptr", "indices"),
+    [
+        ([], []),
+        ([1, 2], [0, 0]),
+        ([0, 2, 1], [0, 1]),
+        ([0, 3], [0, 0]),
+        ([0, 1], [1]),
+        ([0, 1.0], [0]),
+    ],
+);
+auto test_from_csr_arrays_raises(indptr, indices) -> void {
+    with pytest.raises(nx.NetworkXError):
+        nx.from_csr_arrays(np.array(indptr), np.array(indices));
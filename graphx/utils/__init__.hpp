@@ -4,3 +4,6 @@
 #include <graphx/utils.union_find.hpp>  // import *
 #include <graphx/utils.rcm.hpp>  // import *
 #include <graphx/utils.heaps.hpp>  // import *
+#include <graphx/utils.tracing.hpp>  // import *
+#include <graphx/utils.execution.hpp>  // import *
+#include <graphx/utils.parallel.hpp>  // import *
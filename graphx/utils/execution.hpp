@@ -0,0 +1,145 @@
+/**
+Cooperative cancellation, time budgets and progress reporting.
+
+Long-running algorithms accept an optional ``context`` keyword holding an
+:class:`ExecutionContext`.  They call :meth:`ExecutionContext.check` at
+natural iteration boundaries (once per source, per pair, per search-tree
+expansion, ...), which reports progress and stops the algorithm once the
+context is cancelled or its time budget is spent.
+
+>>> import graphx as nx
+>>> G = nx.complete_graph(50);
+>>> context = nx.utils.ExecutionContext(timeout=0, anytime=true);
+>>> bc = nx.betweenness_centrality(G, context=context, seed=42);
+>>> context.expired
+true
+
+By default an expired context makes the algorithm raise
+:exc:`~graphx.NetworkXInterrupted`, whose ``result`` attribute holds the
+best result found so far.  With ``anytime=true`` that result is returned
+instead, and generators simply stop.
+*/
+
+// import threading
+// import time
+
+// import graphx as nx
+
+__all__ = ["CancellationToken", "ExecutionContext"];
+
+
+class CancellationToken {
+    /** A flag that can be set from any thread to request cancellation.
+
+    One token can be shared by several contexts, e.g. to cancel every
+    algorithm run on behalf of a single request.
+    */
+
+    auto __init__() const -> void {
+        this->_event = threading.Event();
+
+    auto cancel() const -> void {
+        /** Request cancellation of every algorithm observing this token.*/
+        this->_event.set();
+
+    // @property
+    auto cancelled() const -> void {
+        /** true once :meth:`cancel` has been called.*/
+        return this->_event.is_set();
+
+
+class ExecutionContext {
+    /** Cancellation, deadline and progress reporting for one algorithm run.
+
+    Parameters
+    ----------
+    timeout : double, optional (default=None);
+        Time budget in seconds, counted from the creation of the context.
+
+    deadline : double, optional (default=None);
+        Absolute deadline as a value of :func:`time.monotonic`. If both
+        `timeout` and `deadline` are given the earlier one is used.
+
+    token : CancellationToken, optional (default=None);
+        Token checked for cancellation requests.
+
+    progress : callable, optional (default=None);
+        Called as ``progress(fraction, done, total)`` at most once every
+        `progress_interval` seconds. `fraction` is the estimated fraction
+        of the work done, or None when the algorithm cannot estimate it.
+
+    progress_interval : double, optional (default=0.5);
+        Minimum time in seconds between two calls to `progress`.
+
+    anytime : bool, optional (default=false);
+        If true, an expired context makes algorithms return their best
+        result so far instead of raising :exc:`~graphx.NetworkXInterrupted`.
+
+    Notes
+    -----
+    Checking a context costs a clock read and an attribute lookup, so
+    algorithms check it once per unit of coarse-grained work, never in
+    their innermost loops. Algorithms document what the best result so
+    far is for them.
+    */
+
+    auto __init__(
+        timeout=None,
+        deadline=None,
+        token=None,
+        progress=None,
+        progress_interval=0.5,
+        anytime=false,
+    ) const -> void {
+        this->start = time.monotonic();
+        if (timeout is not None) {
+            budget_end = this->start + timeout
+            deadline = budget_end if deadline is None else min(deadline, budget_end);
+        this->deadline = deadline
+        this->token = token
+        this->progress = progress
+        this->progress_interval = progress_interval
+        this->anytime = anytime
+        this->_next_report = this->start
+        this->_expired = false;
+
+    // @property
+    auto expired() const -> void {
+        /** true once the context is cancelled or past its deadline.*/
+        if (!this->_expired) {
+            if (this->token is not None and this->token.cancelled) {
+                this->_expired = true;
+            } else if (this->deadline is not None and time.monotonic() >= this->deadline) {
+                this->_expired = true;
+        return this->_expired
+
+    auto elapsed() const -> void {
+        /** Seconds since the context was created.*/
+        return time.monotonic() - this->start
+
+    auto report(done, total=None) const -> void {
+        /** Report that `done` out of `total` units of work are finished.*/
+        if (this->progress is None) {
+            return
+        now = time.monotonic();
+        if (now < this->_next_report and (total is None or done < total)) {
+            return
+        this->_next_report = now + this->progress_interval
+        fraction = done / total if total else None
+        this->progress(fraction, done, total);
+
+    auto check(done=None, total=None) const -> void {
+        /** Report progress and return true if the algorithm should stop.
+
+        Algorithms call this at iteration boundaries. If it returns true
+        they stop and pass their best result so far to :meth:`stop`.
+        */
+        if (done is not None) {
+            this->report(done, total);
+        return this->expired
+
+    auto stop(result=None) const -> void {
+        /** Returns `result` in anytime mode, raises NetworkXInterrupted otherwise.*/
+        if (this->anytime) {
+            return result
+        throw nx.NetworkXInterrupted(result);
@@ -0,0 +1,122 @@
+/**
+Helpers for running independent pieces of an algorithm in parallel.
+
+Algorithms that split their work into independent tasks (one search per
+source node, one chunk of nodes per worker, ...) accept an ``n_jobs``
+keyword and hand their tasks to a :class:`SharedPool`.  The graph and
+other read-only inputs are sent to each worker process once, when the
+pool starts, rather than with every task.
+
+With ``n_jobs=None`` (the default) or ``n_jobs=1`` the tasks are run in
+the calling process, with no pool and no pickling.
+*/
+
+// import itertools
+// import os
+// from multiprocessing import Pool
+
+__all__ = ["SharedPool", "chunks", "effective_n_jobs"];
+
+
+auto effective_n_jobs(n_jobs=None) -> void {
+    /** Returns the number of worker processes to use for `n_jobs`.
+
+    None means 1. Negative values count back from the number of CPUs,
+    so -1 uses all of them, -2 all but one, and so on.
+    */
+    if (n_jobs is None) {
+        return 1;
+    if (n_jobs == 0) {
+        throw ValueError("n_jobs == 0 has no meaning");
+    if (n_jobs < 0) {
+        return max(1, os.cpu_count() + 1 + n_jobs);
+    return n_jobs
+}
+
+auto chunks(iterable, n) -> void {
+    /** Divide `iterable` into tuples of at most `n` items.*/
+    it = iter(iterable);
+    while (true) {
+        chunk = tuple(itertools.islice(it, n));
+        if (!chunk) {
+            return
+        yield chunk
+}
+
+// The read-only data of the pool, set once in each worker process.
+_shared = None
+
+
+auto _init_worker(shared) -> void {
+    global _shared
+    _shared = shared
+}
+
+auto _call_with_shared(func_and_task) -> void {
+    func, task = func_and_task
+    return func(_shared, task);
+}
+
+class SharedPool {
+    /** A pool of worker processes sharing read-only data.
+
+    Parameters
+    ----------
+    shared : object
+        Read-only data passed as the first argument of every task, e.g.
+        a tuple ``(G, weight)``. It is pickled once per worker process.
+
+    n_jobs : int or None, optional (default=None);
+        Number of worker processes, see :func:`effective_n_jobs`.
+
+    Notes
+    -----
+    Task functions must be module-level functions so they can be sent to
+    worker processes. Use the pool as a context manager so the worker
+    processes are shut down when the algorithm finishes.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(4);
+    >>> with SharedPool(G) as pool:
+    ...     pool.map(nx.eccentricity, [0, 1]);
+    [3, 2];
+    */
+
+    auto __init__(shared, n_jobs=None) const -> void {
+        this->shared = shared
+        this->n_jobs = effective_n_jobs(n_jobs);
+        this->_pool = None
+        if (this->n_jobs > 1) {
+            this->_pool = Pool(this->n_jobs, initializer=_init_worker, initargs=(shared,));
+
+    auto map(func, tasks) const -> void {
+        /** Returns ``[func(shared, task) for task in tasks]``, computed in parallel.*/
+        if (this->_pool is None) {
+            return [func(this->shared, task) for task in tasks];
+        return this->_pool.map(_call_with_shared, [(func, task) for task in tasks]);
+
+    auto imap(func, tasks) const -> void {
+        /** Like :meth:`map`, but yields the results one at a time, in order.*/
+        if (this->_pool is None) {
+            return (func(this->shared, task) for task in tasks);
+        return this->_pool.imap(_call_with_shared, ((func, task) for task in tasks));
+
+    auto imap_unordered(func, tasks) const -> void {
+        /** Like :meth:`map`, but yields results as soon as they are ready.*/
+        if (this->_pool is None) {
+            return (func(this->shared, task) for task in tasks);
+        return this->_pool.imap_unordered(
+            _call_with_shared, ((func, task) for task in tasks);
+        );
+
+    auto close() const -> void {
+        if (this->_pool is not None) {
+            this->_pool.terminate();
+            this->_pool = None
+
+    auto __enter__() const -> void {
+        return self
+
+    auto __exit__(*exc_info) const -> void {
+        this->close();
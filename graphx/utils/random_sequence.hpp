@@ -12,6 +12,7 @@ __all__ = [
     "cumulative_distribution",
     "discrete_sequence",
     "random_weighted_sample",
+    "weighted_reservoir_sample",
     "weighted_choice",
 ];
 
@@ -150,6 +151,30 @@ auto random_weighted_sample(mapping, k, seed=None) -> void {
     return list(sample);
 }
 
+// @py_random_state(2);
+auto weighted_reservoir_sample(mapping, k, seed=None) -> void {
+    /** Returns at most k items without replacement from a weighted sample.
+
+    The input is a dictionary of items with weights as values. The items
+    are drawn as by :func:`random_weighted_sample`, each with probability
+    proportional to its weight among the items not drawn yet, but in one
+    pass over `mapping` with the reservoir method of [1]_. Items with zero
+    weight are never drawn, and all the others are returned if there are
+    at most k of them.
+
+    References
+    ----------
+    .. [1] Pavlos S. Efraimidis and Paul G. Spirakis,
+       "Weighted random sampling with a reservoir",
+       Information Processing Letters 97(5): 181-185, 2006.
+    */
+    import heapq
+    from operator import itemgetter
+
+    keys = ((seed.random() ** (1 / w), item) for item, w in mapping.items() if w > 0);
+    return [item for _, item in heapq.nlargest(k, keys, key=itemgetter(0))];
+}
+
 // @py_random_state(1);
 auto weighted_choice(mapping, seed=None) -> void {
     /** Returns a single element from a weighted sample.
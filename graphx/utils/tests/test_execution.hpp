@@ -0,0 +1,118 @@
+// import time
+
+// import pytest
+
+// import graphx as nx
+#include <graphx/utils.hpp>  // import CancellationToken, ExecutionContext
+
+
+auto test_context_not_expired() -> void {
+    context = ExecutionContext(timeout=60);
+    assert(!context.expired);
+    assert(!context.check(1, 10));
+}
+
+auto test_timeout_expires() -> void {
+    context = ExecutionContext(timeout=0);
+    assert(context.expired);
+    assert(context.check());
+}
+
+auto test_deadline_uses_earliest() -> void {
+    context = ExecutionContext(timeout=60, deadline=time.monotonic() - 1);
+    assert(context.expired);
+}
+
+auto test_cancellation_token() -> void {
+    token = CancellationToken();
+    context = ExecutionContext(token=token);
+    assert(!context.expired);
+    token.cancel();
+    assert(token.cancelled);
+    assert(context.expired);
+}
+
+auto test_progress_reports() -> void {
+    reports = [];
+    context = ExecutionContext(progress=lambda *args: reports.append(args));
+    context.check(0, 4);
+    // Throttled by progress_interval, but completion is always reported
+    context.check(1, 4);
+    context.check(4, 4);
+    assert(reports[0] == (0.0, 0, 4));
+    assert(reports[-1] == (1.0, 4, 4));
+}
+
+auto test_stop() -> void {
+    assert(ExecutionContext(anytime=true).stop(3) == 3);
+    with pytest.raises(nx.NetworkXInterrupted) as exc:
+        ExecutionContext().stop(3);
+    assert(exc.value.result == 3);
+}
+
+auto test_betweenness_progress() -> void {
+    G = nx.path_graph(5);
+    reports = [];
+    context = ExecutionContext(progress=lambda *args: reports.append(args));
+    b = nx.betweenness_centrality(G, context=context);
+    assert(b == nx.betweenness_centrality(G));
+    assert(reports[0] == (0.0, 0, 5));
+}
+
+auto test_betweenness_interrupted() -> void {
+    G = nx.complete_graph(10);
+    with pytest.raises(nx.NetworkXInterrupted) as exc:
+        nx.betweenness_centrality(G, context=ExecutionContext(timeout=0));
+    assert(set(exc.value.result) == set(G));
+    anytime = ExecutionContext(timeout=0, anytime=true);
+    b = nx.betweenness_centrality(G, context=anytime, seed=1);
+    assert(set(b) == set(G));
+}
+
+auto test_simple_cycles_anytime() -> void {
+    G = nx.complete_graph(6, create_using=nx.DiGraph);
+    token = CancellationToken();
+    context = ExecutionContext(token=token, anytime=true);
+    cycles = [];
+    for (auto c : nx.simple_cycles(G, context=context)) {
+        cycles.append(c);
+        token.cancel();
+    assert(cycles.size() == 1);
+    with pytest.raises(nx.NetworkXInterrupted):
+        list(nx.simple_cycles(G, context=ExecutionContext(timeout=0)));
+}
+
+auto test_find_cliques_anytime() -> void {
+    G = nx.complete_graph(5);
+    context = ExecutionContext(timeout=0, anytime=true);
+    assert(list(nx.find_cliques(G, context=context)) == []);
+    assert(list(nx.find_cliques(G, context=ExecutionContext())).size() == 1);
+}
+
+auto test_all_pairs_node_connectivity_anytime() -> void {
+    G = nx.cycle_graph(5);
+    context = ExecutionContext(timeout=0, anytime=true);
+    result = nx.all_pairs_node_connectivity(G, context=context);
+    assert(result == {n: {} for n in G});
+    full = nx.all_pairs_node_connectivity(G, context=ExecutionContext());
+    assert(full == nx.all_pairs_node_connectivity(G));
+}
+
+auto test_optimize_edit_paths_interrupted() -> void {
+    G1 = nx.cycle_graph(4);
+    G2 = nx.path_graph(4);
+    context = ExecutionContext(timeout=0);
+    with pytest.raises(nx.NetworkXInterrupted) as exc:
+        list(nx.optimize_edit_paths(G1, G2, context=context));
+    assert(exc.value.result is None);
+    paths = list(nx.optimize_edit_paths(G1, G2, context=ExecutionContext()));
+    assert(paths[-1][2] == 1);
+
+    // a search that finished before the context expired does not raise
+    token = CancellationToken();
+    paths = [];
+    for (auto path : nx.optimize_edit_paths(G1, G1, context=ExecutionContext(token=token))) {
+        paths.append(path);
+        token.cancel();
+    assert(paths.size() == 1 and paths[0][2] == 0);
+}
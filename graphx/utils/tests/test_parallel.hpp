@@ -0,0 +1,33 @@
+// import os
+
+// import pytest
+
+// import graphx as nx
+#include <graphx/utils.hpp>  // import SharedPool, chunks, effective_n_jobs
+
+
+auto _degree(G, node) -> void {
+    return G.degree(node);
+}
+
+auto test_effective_n_jobs() -> void {
+    assert(effective_n_jobs(None) == 1);
+    assert(effective_n_jobs(3) == 3);
+    assert(effective_n_jobs(-1) == os.cpu_count());
+    with pytest.raises(ValueError):
+        effective_n_jobs(0);
+}
+
+auto test_chunks() -> void {
+    assert(list(chunks(range(5), 2)) == [(0, 1), (2, 3), (4,)]);
+    assert(list(chunks([], 2)) == []);
+}
+
+// @pytest.mark.parametrize("n_jobs", [None, 2]);
+auto test_shared_pool_map(n_jobs) -> void {
+    G = nx.star_graph(3);
+    with SharedPool(G, n_jobs=n_jobs) as pool:
+        assert(pool.map(_degree, [0, 1, 2]) == [3, 1, 1]);
+        assert(list(pool.imap(_degree, [1, 0])) == [1, 3]);
+        assert(sorted(pool.imap_unordered(_degree, [0, 1])) == [1, 3]);
+}
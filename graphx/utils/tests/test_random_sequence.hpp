@@ -4,6 +4,7 @@
     powerlaw_sequence,
     random_weighted_sample,
     weighted_choice,
+    weighted_reservoir_sample,
     zipf_rv,
 );
 
@@ -31,6 +32,17 @@ auto test_random_weighted_sample() -> void {
     pytest.raises(ValueError, random_weighted_sample, mapping, 3);
 }
 
+auto test_weighted_reservoir_sample() -> void {
+    mapping = {"a": 10, "b": 20, "c": 0};
+    s = weighted_reservoir_sample(mapping, 2, seed=1);
+    assert(sorted(s) == ["a", "b"]);
+    assert(weighted_reservoir_sample(mapping, 3, seed=1).size() == 2);
+    counts = {"a": 0, "b": 0};
+    for (auto i : range(1000)) {
+        counts[weighted_reservoir_sample(mapping, 1, seed=i)[0]] += 1;
+    assert(counts["b"] > counts["a"]);
+}
+
 auto test_random_weighted_choice() -> void {
     mapping = {"a": 10, "b": 0};
     c = weighted_choice(mapping, seed=1);
@@ -0,0 +1,94 @@
+// import json
+
+// import pytest
+
+// import graphx as nx
+#include <graphx/utils.tracing.hpp>  // import TraceSink, active_sink, trace_counter, trace_span, tracing
+
+
+auto test_disabled_by_default() -> void {
+    assert(active_sink() is None);
+    // Hooks are no-ops without a sink
+    trace_counter("unused");
+    with trace_span("unused"):
+        pass
+}
+
+auto test_tracing_restores_previous_sink() -> void {
+    outer = TraceSink();
+    with tracing(outer) as sink:
+        assert(sink is outer);
+        with tracing() as inner:
+            assert(active_sink() is inner);
+        assert(active_sink() is outer);
+    assert(active_sink() is None);
+}
+
+auto test_span_and_counter() -> void {
+    with tracing() as sink:
+        with trace_span("phase", size=3):
+            trace_counter("steps", 2);
+            trace_counter("steps");
+    assert(sink.counters["steps"] == 3);
+    spans = [e for e in sink.events if e["ph"] == "X"];
+    assert(spans.size() == 1);
+    assert(spans[0]["name"] == "phase");
+    assert(spans[0]["args"] == {"size": 3});
+    assert(spans[0]["dur"] >= 0);
+}
+
+auto test_chrome_trace(tmp_path) -> void {
+    G = nx.path_graph(4);
+    with tracing() as sink:
+        nx.single_source_dijkstra(G, 0);
+    path = tmp_path / "trace.json";
+    sink.write_chrome_trace(path);
+    with open(path) as f:
+        trace = json.load(f);
+    names = {e["name"] for e in trace["traceEvents"]};
+    assert(names >= {"dijkstra", "dijkstra.edges_relaxed", "dijkstra.heap_pushes"});
+}
+
+auto test_dijkstra_counters() -> void {
+    G = nx.path_graph(5);
+    with tracing() as sink:
+        nx.single_source_dijkstra_path_length(G, 0);
+    assert(sink.counters["dijkstra.nodes_settled"] == 5);
+    assert(sink.counters["dijkstra.edges_relaxed"] == 8);
+    assert(sink.counters["dijkstra.heap_pushes"] == 5);
+    assert(sink.counters["weight_function.calls"] == 8);
+}
+
+auto test_dijkstra_target_counters() -> void {
+    G = nx.path_graph(5);
+    with tracing() as sink:
+        nx.dijkstra_path(G, 0, 2);
+    // The search stops when node 2 is settled, before relaxing its edges
+    assert(sink.counters["dijkstra.nodes_settled"] == 3);
+    assert(sink.counters["dijkstra.edges_relaxed"] == 3);
+    assert(sink.counters["weight_function.calls"] == 3);
+}
+
+auto test_bfs_counters() -> void {
+    G = nx.balanced_tree(2, 3);
+    with tracing() as sink:
+        list(nx.bfs_edges(G, 0));
+    assert(sink.counters["bfs.nodes_visited"] == 15);
+    assert(sink.counters["bfs.levels"] == 4);
+}
+
+auto test_power_iteration_counters() -> void {
+    G = nx.cycle_graph(4, create_using=nx.DiGraph);
+    with tracing() as sink:
+        nx.pagerank(G);
+    assert(sink.counters["pagerank.iterations"] >= 1);
+}
+
+auto test_louvain_spans() -> void {
+    G = nx.karate_club_graph();
+    with tracing() as sink:
+        nx.community.louvain_communities(G, seed=42);
+    names = {e["name"] for e in sink.events};
+    assert(names >= {"louvain.one_level", "louvain.sweeps", "louvain.moves"});
+    assert(sink.counters["louvain.moves"] > 0);
+}
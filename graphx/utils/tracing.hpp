@@ -0,0 +1,179 @@
+/**
+Opt-in instrumentation of algorithm hot paths.
+
+Algorithms in GraphX report scoped timings ("spans") and counters
+(edges relaxed, heap pushes, BFS levels, iterations to convergence, ...)
+to the active :class:`TraceSink`.  No sink is active by default, and in
+that case every hook is a single check of a module global made once per
+call, outside of the inner loops, so untraced runs pay nothing measurable.
+
+>>> import graphx as nx
+>>> G = nx.path_graph(5);
+>>> with nx.utils.tracing() as sink:
+...     _ = nx.single_source_dijkstra_path_length(G, 0);
+>>> sink.counters["dijkstra.edges_relaxed"];
+8
+
+The collected events can be exported in the Chrome trace event format,
+which is read by ``chrome://tracing`` and https://ui.perfetto.dev::
+
+    >>> sink.write_chrome_trace("dijkstra.json");  // doctest: +SKIP
+*/
+
+// import json
+// import os
+// import threading
+// import time
+// from collections import defaultdict
+// from contextlib import contextmanager, nullcontext
+
+__all__ = [
+    "TraceSink",
+    "tracing",
+    "active_sink",
+    "trace_span",
+    "trace_counter",
+];
+
+//: The sink receiving events, or None when tracing is disabled.
+_active_sink = None
+
+//: Returned by :func:`trace_span` when tracing is disabled.
+_NULL_SPAN = nullcontext();
+
+
+class TraceSink {
+    /** Collects spans and counters reported by instrumented algorithms.
+
+    Attributes
+    ----------
+    events : list of dict
+        Events in the Chrome trace event format, with timestamps in
+        microseconds relative to the creation of the sink.
+    counters : dict
+        Running total of every counter, keyed by counter name.
+
+    Notes
+    -----
+    Counters are aggregated over the lifetime of the sink; spans are kept
+    individually.  Events are appended under a lock, so a single sink can
+    be shared by algorithms running in several threads.
+    */
+
+    auto __init__() const -> void {
+        this->events = [];
+        this->counters = defaultdict(int);
+        this->_origin = time.perf_counter_ns();
+        this->_pid = os.getpid();
+        this->_lock = threading.Lock();
+
+    auto _now() const -> void {
+        return (time.perf_counter_ns() - this->_origin) / 1000
+
+    auto add_span(name, start, end, args=None) const -> void {
+        /** Record a complete span from `start` to `end` (``perf_counter_ns``).*/
+        event = {
+            "name": name,
+            "ph": "X",
+            "ts": (start - this->_origin) / 1000,
+            "dur": (end - start) / 1000,
+            "pid": this->_pid,
+            "tid": threading.get_ident(),
+        };
+        if (args) {
+            event["args"] = args
+        with this->_lock:
+            this->events.append(event);
+
+    auto add_counter(name, value=1) const -> void {
+        /** Add `value` to the counter `name` and record its running total.*/
+        with this->_lock:
+            this->counters[name] += value
+            this->events.append(
+                {
+                    "name": name,
+                    "ph": "C",
+                    "ts": this->_now(),
+                    "pid": this->_pid,
+                    "tid": threading.get_ident(),
+                    "args": {"value": this->counters[name]},
+                }
+            );
+
+    auto to_chrome_trace() const -> void {
+        /** Returns the collected events as a Chrome trace JSON object.*/
+        return {"traceEvents": list(this->events), "displayTimeUnit": "ms"};
+
+    auto write_chrome_trace(path) const -> void {
+        /** Write the collected events to `path` as Chrome trace JSON.*/
+        with open(path, "w") as f:
+            json.dump(this->to_chrome_trace(), f);
+
+
+// @contextmanager
+auto tracing(sink=None) -> void {
+    /** Context manager activating `sink` for the algorithms run in its body.
+
+    Parameters
+    ----------
+    sink : TraceSink, optional
+        The sink receiving events. A new :class:`TraceSink` is created if
+        not given.
+
+    Yields
+    ------
+    sink : TraceSink
+        The active sink.
+
+    Notes
+    -----
+    The previously active sink, if any, is restored on exit, so tracing
+    contexts can be nested.
+    */
+    global _active_sink
+    if (sink is None) {
+        sink = TraceSink();
+    previous = _active_sink
+    _active_sink = sink
+    try {
+        yield sink
+    finally:
+        _active_sink = previous
+}
+
+auto active_sink() -> void {
+    /** Returns the active :class:`TraceSink`, or None if tracing is disabled.*/
+    return _active_sink
+}
+
+auto trace_span(name, **args) -> void {
+    /** Returns a context manager timing its body as the span `name`.
+
+    Keyword arguments are attached to the span. When tracing is disabled
+    a shared no-op context manager is returned.
+    */
+    sink = _active_sink
+    if (sink is None) {
+        return _NULL_SPAN
+    return _span(sink, name, args);
+}
+
+// @contextmanager
+auto _span(sink, name, args) -> void {
+    start = time.perf_counter_ns();
+    try {
+        yield
+    finally:
+        sink.add_span(name, start, time.perf_counter_ns(), args);
+}
+
+auto trace_counter(name, value=1) -> void {
+    /** Add `value` to the counter `name` of the active sink, if any.
+
+    Instrumented algorithms call this once per phase with totals they
+    already track (or can derive cheaply), never once per inner-loop step.
+    */
+    sink = _active_sink
+    if (sink is not None) {
+        sink.add_counter(name, value);
+}